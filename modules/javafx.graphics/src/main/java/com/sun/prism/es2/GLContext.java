@@ -27,11 +27,13 @@ package com.sun.prism.es2;
 
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
+import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
 import com.sun.javafx.PlatformUtil;
 import com.sun.prism.MeshView;
 import com.sun.prism.PhongMaterial.MapType;
 import com.sun.prism.Texture.WrapMode;
+import com.sun.prism.impl.BufferUtil;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.paint.Color;
 
@@ -134,6 +136,15 @@ abstract class GLContext {
     private static final int FBO_ID_NOCACHE = -2;
     private int nativeFBOID = PlatformUtil.isMac() || PlatformUtil.isIOS() ? FBO_ID_NOCACHE : FBO_ID_UNSET;
 
+    // Must match the vertex layout in com.sun.prism.impl.VertexBuffer
+    private static final int FLOATS_PER_VERT = 7;
+    private static final int BYTES_PER_VERT = 4;
+    // Direct buffer holding the coordinates, then the colors, of the batch
+    // passed to nDrawIndexedQuadsBuffered. It is reused for every batch and
+    // only reallocated when a larger batch comes along.
+    private ByteBuffer vertexStage;
+    private FloatBuffer vertexStageCoords;
+
     private static native void nActiveTexture(long nativeCtxInfo, int texUnit);
     private static native void nBindFBO(long nativeCtxInfo, int nativeFBOID);
     private static native void nBindTexture(long nativeCtxInfo, int texID);
@@ -224,6 +235,8 @@ abstract class GLContext {
     private static native void nDisableVertexAttributes(long nativeCtxInfo);
     private static native void nDrawIndexedQuads(long nativeCtxInfo, int numVertices,
             float dataf[], byte datab[]);
+    private static native void nDrawIndexedQuadsBuffered(long nativeCtxInfo, int numVertices,
+            ByteBuffer vertices);
     private static native int nCreateIndexBuffer16(long nativeCtxInfo, short data[], int n);
     private static native void nSetIndexBuffer(long nativeCtxInfo, int buffer);
 
@@ -720,7 +733,25 @@ abstract class GLContext {
     }
 
     void drawIndexedQuads(float coords[], byte colors[], int numVertices) {
-        nDrawIndexedQuads(nativeCtxInfo, numVertices, coords, colors);
+        if (!PrismSettings.streamVertexBuffers) {
+            nDrawIndexedQuads(nativeCtxInfo, numVertices, coords, colors);
+            return;
+        }
+        // The bulk puts copy into native memory without entering a JNI
+        // critical region, so the GC is never held up by a pinned array.
+        int numCoords = numVertices * FLOATS_PER_VERT;
+        int colorOffset = numCoords * Float.BYTES;
+        int size = colorOffset + numVertices * BYTES_PER_VERT;
+        if (vertexStage == null || vertexStage.capacity() < size) {
+            vertexStage = BufferUtil.newByteBuffer(size);
+            vertexStageCoords = vertexStage.asFloatBuffer();
+        }
+        vertexStageCoords.clear();
+        vertexStageCoords.put(coords, 0, numCoords);
+        vertexStage.clear();
+        vertexStage.position(colorOffset);
+        vertexStage.put(colors, 0, numVertices * BYTES_PER_VERT);
+        nDrawIndexedQuadsBuffered(nativeCtxInfo, numVertices, vertexStage);
     }
 
     int createIndexBuffer16(short data[]) {
@@ -68,6 +68,7 @@ public final class PrismSettings {
     public static final boolean disableRegionCaching;
     public static final boolean forcePow2;
     public static final boolean noClampToZero;
+    public static final boolean streamVertexBuffers;
     public static final boolean disableD3D9Ex;
     public static final boolean allowHiDPIScaling;
     public static final long maxVram;
@@ -263,6 +264,9 @@ public final class PrismSettings {
         forcePow2 = getBoolean(systemProperties, "prism.forcepowerof2", false);
         noClampToZero = getBoolean(systemProperties, "prism.noclamptozero", false);
 
+        /* Upload es2 vertex batches through a streaming buffer object */
+        streamVertexBuffers = getBoolean(systemProperties, "prism.streamvbo", false);
+
         allowHiDPIScaling = getBoolean(systemProperties, "prism.allowhidpi", true);
 
         maxVram = getLong(systemProperties, "prism.maxvram", 512 * 1024 * 1024,
@@ -292,6 +296,7 @@ public final class PrismSettings {
             }
             printBooleanOption(forcePow2, "Forcing power of 2 sizes for textures");
             printBooleanOption(!noClampToZero, "Using hardware CLAMP_TO_ZERO mode");
+            printBooleanOption(streamVertexBuffers, "Streaming vertex data through buffer objects");
             printBooleanOption(allowHiDPIScaling, "Opting in for HiDPI pixel scaling");
         }
 
@@ -1604,15 +1604,52 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
 
 #define SAFE_TO_MULT(a, b) (((a) > 0) && ((b) >= 0) && ((0x7fffffff / (a)) > (b)))
 
+/*
+ * decompressIndirect decodes a strip of scanlines into a native buffer and
+ * copies the whole strip into the destination array with a single pin,
+ * rather than pinning the array for every row.  STRIP_SIZE is the target
+ * size of a strip in bytes; a strip holds at least one call's worth of rows.
+ */
+#define STRIP_SIZE (64 * 1024)
+
+/*
+ * Maximum number of progress updates sent to Java while decoding an image.
+ * Every update unpins and repins the stream buffer.
+ */
+#define PROGRESS_UPDATES 20
+
+static jboolean updateImageProgress(JNIEnv *env, jobject this,
+                                    imageIODataPtr data, j_decompress_ptr cinfo,
+                                    JDIMENSION lines) {
+    RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+    (*env)->CallVoidMethod(env, this,
+            JPEGImageLoader_updateImageProgressID,
+            lines);
+    if ((*env)->ExceptionCheck(env)) {
+        return JNI_FALSE;
+    }
+    if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
+        ThrowByName(env,
+                "java/io/IOException",
+                "Array pin failed");
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
 (JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
     j_decompress_ptr cinfo = (j_decompress_ptr) data->jpegObj;
-    struct jpeg_source_mgr *src = cinfo->src;
     sun_jpeg_error_ptr jerr;
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
-    JSAMPROW scanline_ptr = NULL;
+    int strip_height;
+    int i;
+    JDIMENSION progress_step;
+    JDIMENSION next_progress = 0;
+    JSAMPLE *strip = NULL;
+    JSAMPARRAY strip_rows = NULL;
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1625,7 +1662,36 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
+    strip_height = STRIP_SIZE / bytes_per_row;
+    if (strip_height < cinfo->rec_outbuf_height) {
+        strip_height = cinfo->rec_outbuf_height;
+    }
+    if (strip_height > (int) cinfo->output_height) {
+        strip_height = cinfo->output_height;
+    }
+    if (strip_height < 1) {
+        strip_height = 1;
+    }
+
+    strip = (JSAMPLE *) malloc((size_t) bytes_per_row * strip_height * sizeof(JSAMPLE));
+    strip_rows = (JSAMPARRAY) malloc(strip_height * sizeof(JSAMPROW));
+    if (strip == NULL || strip_rows == NULL) {
+        free(strip);
+        free(strip_rows);
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Reading JPEG Stream");
+        return JNI_FALSE;
+    }
+    for (i = 0; i < strip_height; i++) {
+        strip_rows[i] = strip + (size_t) i * bytes_per_row;
+    }
+
+    progress_step = (cinfo->output_height + PROGRESS_UPDATES - 1) / PROGRESS_UPDATES;
+
     if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
+        free(strip);
+        free(strip_rows);
         ThrowByName(env,
                 "java/io/IOException",
                 "Array pin failed");
@@ -1644,65 +1710,57 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                     buffer);
             ThrowByName(env, "java/io/IOException", buffer);
         }
+        free(strip);
+        free(strip_rows);
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         return JNI_FALSE;
     }
 
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
-    if (scanline_ptr == NULL) {
-        ThrowByName(env,
-                "java/lang/OutOfMemoryError",
-                "Reading JPEG Stream");
-        return JNI_FALSE;
-    }
-
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
-        if (report_progress == JNI_TRUE) {
-            RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
-            (*env)->CallVoidMethod(env, this,
-                    JPEGImageLoader_updateImageProgressID,
-                    cinfo->output_scanline);
-            if ((*env)->ExceptionCheck(env)) {
-                free(scanline_ptr);
-                return JNI_FALSE;
-            }
-            if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
-                free(scanline_ptr);
-                ThrowByName(env,
-                          "java/io/IOException",
-                          "Array pin failed");
+        int num_scanlines = 0;
+        jbyte *body;
+
+        if (report_progress == JNI_TRUE && cinfo->output_scanline >= next_progress) {
+            if (!updateImageProgress(env, this, data, cinfo, cinfo->output_scanline)) {
+                free(strip);
+                free(strip_rows);
                 return JNI_FALSE;
             }
+            next_progress = cinfo->output_scanline + progress_step;
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
-            jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
-            if (body == NULL) {
-                fprintf(stderr, "decompressIndirect: GetPrimitiveArrayCritical returns NULL: out of memory\n");
-                free(scanline_ptr);
-                return JNI_FALSE;
+        /* jpeg_read_scanlines returns at most rec_outbuf_height rows per call */
+        while (num_scanlines < strip_height &&
+               cinfo->output_scanline < cinfo->output_height) {
+            JDIMENSION lines = jpeg_read_scanlines(cinfo,
+                    strip_rows + num_scanlines, strip_height - num_scanlines);
+            if (lines == 0) {
+                break;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
-            (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            num_scanlines += lines;
+        }
+        if (num_scanlines == 0) {
+            /* No progress is possible; jpeg_finish_decompress reports it. */
+            break;
         }
-    }
-    free(scanline_ptr);
 
-    if (report_progress == JNI_TRUE) {
-        RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
-        (*env)->CallVoidMethod(env, this,
-                JPEGImageLoader_updateImageProgressID,
-                cinfo->output_height);
-        if ((*env)->ExceptionCheck(env)) {
+        body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
+        if (body == NULL) {
+            fprintf(stderr, "decompressIndirect: GetPrimitiveArrayCritical returns NULL: out of memory\n");
+            free(strip);
+            free(strip_rows);
+            RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
             return JNI_FALSE;
         }
-        if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
-            ThrowByName(env,
-                "java/io/IOException",
-                "Array pin failed");
+        memcpy(body + offset, strip, (size_t) bytes_per_row * num_scanlines);
+        (*env)->ReleasePrimitiveArrayCritical(env, barray, body, 0);
+        offset += bytes_per_row * num_scanlines;
+    }
+    free(strip);
+    free(strip_rows);
+
+    if (report_progress == JNI_TRUE) {
+        if (!updateImageProgress(env, this, data, cinfo, cinfo->output_height)) {
             return JNI_FALSE;
         }
     }
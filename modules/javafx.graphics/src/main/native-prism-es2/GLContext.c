@@ -1675,6 +1675,111 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuads
     if (pFloat) (*env)->ReleasePrimitiveArrayCritical(env, dataf, pFloat, JNI_ABORT);
 }
 
+/* Smallest size of the streaming vertex buffer, see reserveVertexRing */
+#define VERTEX_RING_MIN_SIZE (1024 * 1024)
+
+/*
+ * Reserves size bytes in the context's streaming vertex buffer and returns
+ * their offset, or -1 on failure. Data is appended until the buffer is full,
+ * then the buffer is orphaned with glBufferData(NULL) so the driver can hand
+ * out new storage while the GPU still reads the previous batches; no upload
+ * waits for a pending draw. The buffer is left bound to GL_ARRAY_BUFFER.
+ */
+static GLintptr reserveVertexRing(ContextInfo *ctx, GLsizeiptr size) {
+    GLintptr offset;
+
+    if (ctx->vertexRingBuffer == 0) {
+        ctx->glGenBuffers(1, &ctx->vertexRingBuffer);
+        if (ctx->vertexRingBuffer == 0) {
+            return -1;
+        }
+    }
+    ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->vertexRingBuffer);
+
+    if (ctx->vertexRingOffset + size > ctx->vertexRingSize) {
+        GLsizeiptr newSize = ctx->vertexRingSize;
+        if (newSize < size * 4) {
+            newSize = size * 4 > VERTEX_RING_MIN_SIZE ? size * 4 : VERTEX_RING_MIN_SIZE;
+        }
+        glGetError(); /* clear any stale error before the allocation */
+        ctx->glBufferData(GL_ARRAY_BUFFER, newSize, NULL, GL_STREAM_DRAW);
+        if (glGetError() != GL_NO_ERROR) {
+            ctx->glBindBuffer(GL_ARRAY_BUFFER, 0);
+            ctx->vertexRingSize = 0;
+            ctx->vertexRingOffset = 0;
+            return -1;
+        }
+        ctx->vertexRingSize = newSize;
+        ctx->vertexRingOffset = 0;
+    }
+
+    offset = ctx->vertexRingOffset;
+    /* keep every batch 16-byte aligned */
+    ctx->vertexRingOffset += (size + 15) & ~((GLsizeiptr) 15);
+    return offset;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nDrawIndexedQuadsBuffered
+ * Signature: (JILjava/nio/ByteBuffer;)V
+ *
+ * vertices is a direct buffer holding the coordinates of numVertices
+ * vertices followed by their colors, in the layout of nDrawIndexedQuads.
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuadsBuffered
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint numVertices,
+   jobject vertices)
+{
+    char *pData;
+    int numQuads = numVertices / 4;
+    GLsizeiptr floatSize = (GLsizeiptr) numVertices * coordStride;
+    GLsizeiptr byteSize = (GLsizeiptr) numVertices * colorStride;
+    GLintptr offset = -1;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glVertexAttribPointer == NULL)) {
+        return;
+    }
+
+    pData = (char *) (*env)->GetDirectBufferAddress(env, vertices);
+    if ((pData == NULL) ||
+            ((*env)->GetDirectBufferCapacity(env, vertices) < floatSize + byteSize)) {
+        return;
+    }
+
+    if ((ctxInfo->glGenBuffers != NULL) && (ctxInfo->glBindBuffer != NULL) &&
+            (ctxInfo->glBufferData != NULL) && (ctxInfo->glBufferSubData != NULL)) {
+        offset = reserveVertexRing(ctxInfo, floatSize + byteSize);
+    }
+    if (offset < 0) {
+        /* no buffer objects, draw from the direct buffer as client arrays */
+        setVertexAttributePointers(ctxInfo, (float *) pData, pData + floatSize);
+        glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+        return;
+    }
+
+    /* the direct buffer never moves, so no Java array is pinned */
+    ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, offset, floatSize + byteSize, pData);
+
+    ctxInfo->glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, coordStride,
+            (const GLvoid *) jlong_to_ptr((jlong) offset));
+    ctxInfo->glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, coordStride,
+            (const GLvoid *) jlong_to_ptr((jlong) (offset + FLOATS_PER_VC * sizeof(float))));
+    ctxInfo->glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, coordStride,
+            (const GLvoid *) jlong_to_ptr((jlong) (offset + (FLOATS_PER_VC + FLOATS_PER_TC) * sizeof(float))));
+    ctxInfo->glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, colorStride,
+            (const GLvoid *) jlong_to_ptr((jlong) (offset + floatSize)));
+    /* the cached client side pointers are no longer in effect */
+    ctxInfo->vbFloatData = NULL;
+    ctxInfo->vbByteData = NULL;
+
+    glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+
+    /* client side arrays, as used by nDrawIndexedQuads, need no buffer bound */
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateIndexBuffer16
@@ -328,6 +328,11 @@ struct ContextInfoRec {
     char  *vbByteData;
     jboolean gl2;
 
+    /* streaming vertex buffer object used by nDrawIndexedQuadsBuffered */
+    GLuint vertexRingBuffer;
+    GLsizeiptr vertexRingSize;
+    GLintptr vertexRingOffset;
+
     /* Caching properties passed down from Java */
     jboolean vSyncRequested;
 };
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio.jpeg;
+
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageLoadListener;
+import com.sun.javafx.iio.ImageLoader;
+import com.sun.javafx.iio.ImageMetadata;
+import com.sun.javafx.iio.ImageStorage;
+import com.sun.prism.Image;
+import test.com.sun.javafx.iio.ImageTestHelper;
+import java.awt.Color;
+import java.awt.Graphics2D;
+import java.awt.image.BufferedImage;
+import java.io.InputStream;
+import java.util.ArrayList;
+import java.util.List;
+import static org.junit.Assert.*;
+import org.junit.Test;
+
+public class JPEGImageLoaderTest {
+
+    private static final int[] COLORS = { 0xFF0000, 0x00FF00, 0x0000FF, 0xFFFFFF };
+
+    // Horizontal bands of solid color, so every decoded strip can be checked.
+    private BufferedImage createBandedImage(int w, int h, int bandHeight) {
+        BufferedImage bImg = new BufferedImage(w, h, BufferedImage.TYPE_INT_RGB);
+        Graphics2D g = bImg.createGraphics();
+        for (int y = 0, i = 0; y < h; y += bandHeight, i++) {
+            g.setColor(new Color(COLORS[i % COLORS.length]));
+            g.fillRect(0, y, w, bandHeight);
+        }
+        g.dispose();
+        return bImg;
+    }
+
+    private static void assertColor(int expected, int actual, int x, int y) {
+        for (int shift = 0; shift < 24; shift += 8) {
+            int e = (expected >> shift) & 0xFF;
+            int a = (actual >> shift) & 0xFF;
+            if (Math.abs(e - a) > 8) {
+                fail(String.format("pixel %d, %d: expected 0x%06X, got 0x%06X",
+                                   x, y, expected, actual & 0xFFFFFF));
+            }
+        }
+    }
+
+    @Test
+    public void testStripedDecodeWithProgress() throws Exception {
+        // Many times larger than one decode strip in the native loader.
+        final int w = 640, h = 960, bandHeight = 64;
+        BufferedImage bImg = createBandedImage(w, h, bandHeight);
+        InputStream stream = ImageTestHelper.writeImageToStream(bImg, "jpeg", null);
+
+        List<Float> progress = new ArrayList<>();
+        ImageLoadListener listener = new ImageLoadListener() {
+            @Override
+            public void imageLoadProgress(ImageLoader loader, float percentageComplete) {
+                progress.add(percentageComplete);
+            }
+
+            @Override
+            public void imageLoadWarning(ImageLoader loader, String message) {
+            }
+
+            @Override
+            public void imageLoadMetaData(ImageLoader loader, ImageMetadata metadata) {
+            }
+        };
+
+        ImageFrame[] frames = ImageStorage.loadAll(stream, listener, 0, 0, false, 1.0f, false);
+        assertNotNull(frames);
+        assertEquals(1, frames.length);
+        Image img = Image.convertImageFrame(frames[0]);
+        assertEquals(w, img.getWidth());
+        assertEquals(h, img.getHeight());
+
+        // Sample the middle of every band, away from the lossy band edges.
+        for (int y = bandHeight / 2, i = 0; y < h; y += bandHeight, i++) {
+            for (int x = 0; x < w; x += w / 8) {
+                assertColor(COLORS[i % COLORS.length], img.getArgb(x, y), x, y);
+            }
+        }
+
+        // Progress is reported coarsely, in increasing order, up to completion.
+        assertFalse(progress.isEmpty());
+        assertTrue("too many progress updates: " + progress.size(), progress.size() <= 25);
+        for (int i = 1; i < progress.size(); i++) {
+            assertTrue(progress.get(i) >= progress.get(i - 1));
+        }
+        assertEquals(100f, progress.get(progress.size() - 1), 0f);
+    }
+}
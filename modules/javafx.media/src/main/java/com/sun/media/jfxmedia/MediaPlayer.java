@@ -206,6 +206,13 @@ public interface MediaPlayer {
      */
     public long getAudioSyncDelay();
 
+    /**
+     * Retrieve a snapshot of the playback statistics.
+     *
+     * @return the current metrics or null if the player does not collect them
+     */
+    public MediaPlayerMetrics getMetrics();
+
     /**
      * Begins playing of the media.  To ensure smooth playback, catch the
      * onReady event in the MediaPlayerListener before playing.
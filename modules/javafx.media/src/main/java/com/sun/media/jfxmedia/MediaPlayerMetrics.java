@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmedia;
+
+/**
+ * An immutable snapshot of the playback statistics a player collects while it
+ * is running. Counters are cumulative since the player was created.
+ */
+public final class MediaPlayerMetrics {
+    /** Number of histogram buckets. */
+    public static final int BUCKET_COUNT = 16;
+    /** Upper bound of the first histogram bucket in microseconds. */
+    public static final long HISTOGRAM_BASE_MICROS = 128;
+
+    // Snapshot layout, must match CPipelineMetrics
+    private static final int FRAMES_DECODED = 0;
+    private static final int FRAMES_RENDERED = 1;
+    private static final int FRAMES_DROPPED = 2;
+    private static final int FRAMES_LATE = 3;
+    private static final int QUEUE_UNDERRUNS = 4;
+    private static final int AV_DRIFT_MICROS = 5;
+    private static final int COUNTER_COUNT = 6;
+
+    private static final int DECODE_LATENCY = 0;
+    private static final int COLOR_CONVERSION = 1;
+    private static final int SINK_QUEUE = 2;
+    private static final int PRESENTATION_DELAY = 3;
+    private static final int HISTOGRAM_COUNT = 4;
+
+    private static final int HISTOGRAM_SNAPSHOT_SIZE = BUCKET_COUNT + 2;
+
+    /** Number of values in a snapshot array. */
+    public static final int SNAPSHOT_SIZE =
+            COUNTER_COUNT + HISTOGRAM_COUNT * HISTOGRAM_SNAPSHOT_SIZE;
+
+    /**
+     * A latency distribution in power of two buckets. Bucket 0 counts samples
+     * below {@link #HISTOGRAM_BASE_MICROS}, bucket i counts samples below
+     * {@code HISTOGRAM_BASE_MICROS << i} and the last bucket counts the rest.
+     */
+    public static final class Histogram {
+        private final long[] buckets;
+        private final long count;
+        private final long max;
+
+        private Histogram(long[] values, int offset) {
+            buckets = new long[BUCKET_COUNT];
+            System.arraycopy(values, offset, buckets, 0, BUCKET_COUNT);
+            count = values[offset + BUCKET_COUNT];
+            max = values[offset + BUCKET_COUNT + 1];
+        }
+
+        /**
+         * Returns the number of samples in a bucket.
+         */
+        public long getBucket(int index) {
+            return buckets[index];
+        }
+
+        /**
+         * Returns the exclusive upper bound of a bucket in microseconds, or
+         * {@code Long.MAX_VALUE} for the last bucket.
+         */
+        public static long getBucketLimitMicros(int index) {
+            return index < BUCKET_COUNT - 1 ? HISTOGRAM_BASE_MICROS << index : Long.MAX_VALUE;
+        }
+
+        /**
+         * Returns the total number of samples.
+         */
+        public long getCount() {
+            return count;
+        }
+
+        /**
+         * Returns the largest sample in microseconds.
+         */
+        public long getMaxMicros() {
+            return max;
+        }
+
+        /**
+         * Returns an upper bound of the given percentile (0-100) in
+         * microseconds, derived from the bucket limits.
+         */
+        public long getPercentileMicros(double percentile) {
+            if (count == 0) {
+                return 0;
+            }
+            long target = (long)Math.ceil(count * percentile / 100.0);
+            long seen = 0;
+            for (int i = 0; i < BUCKET_COUNT - 1; i++) {
+                seen += buckets[i];
+                if (seen >= target) {
+                    return Math.min(getBucketLimitMicros(i), max);
+                }
+            }
+            return max;
+        }
+    }
+
+    private final long[] counters;
+    private final Histogram[] histograms;
+
+    /**
+     * Creates a snapshot from the values filled in by the native player.
+     *
+     * @param values an array of at least {@link #SNAPSHOT_SIZE} values
+     */
+    public MediaPlayerMetrics(long[] values) {
+        if (values == null || values.length < SNAPSHOT_SIZE) {
+            throw new IllegalArgumentException("values must hold " + SNAPSHOT_SIZE + " elements");
+        }
+        counters = new long[COUNTER_COUNT];
+        System.arraycopy(values, 0, counters, 0, COUNTER_COUNT);
+        histograms = new Histogram[HISTOGRAM_COUNT];
+        for (int i = 0; i < HISTOGRAM_COUNT; i++) {
+            histograms[i] = new Histogram(values, COUNTER_COUNT + i * HISTOGRAM_SNAPSHOT_SIZE);
+        }
+    }
+
+    /**
+     * Returns the number of frames the video decoder produced.
+     */
+    public long getFramesDecoded() {
+        return counters[FRAMES_DECODED];
+    }
+
+    /**
+     * Returns the number of frames the video sink delivered to the renderer.
+     */
+    public long getFramesRendered() {
+        return counters[FRAMES_RENDERED];
+    }
+
+    /**
+     * Returns the number of frames the video sink reported as dropped in its
+     * quality of service statistics.
+     */
+    public long getFramesDropped() {
+        return counters[FRAMES_DROPPED];
+    }
+
+    /**
+     * Returns the number of frames rendered more than one frame duration late.
+     */
+    public long getFramesLate() {
+        return counters[FRAMES_LATE];
+    }
+
+    /**
+     * Returns how many times the audio or video queue ran empty.
+     */
+    public long getQueueUnderruns() {
+        return counters[QUEUE_UNDERRUNS];
+    }
+
+    /**
+     * Returns how late the last video frame was against the audio clock, in
+     * microseconds. Negative values mean the frame was early.
+     */
+    public long getAVDriftMicros() {
+        return counters[AV_DRIFT_MICROS];
+    }
+
+    /**
+     * Time from a buffer entering the video decoder to the decoded frame
+     * leaving it.
+     */
+    public Histogram getDecodeLatency() {
+        return histograms[DECODE_LATENCY];
+    }
+
+    /**
+     * Time spent converting frames to the format requested by the renderer.
+     */
+    public Histogram getColorConversion() {
+        return histograms[COLOR_CONVERSION];
+    }
+
+    /**
+     * Time from a frame leaving the decoder to it reaching the video sink.
+     */
+    public Histogram getSinkQueue() {
+        return histograms[SINK_QUEUE];
+    }
+
+    /**
+     * Lateness of frames delivered by the video sink against the clock.
+     */
+    public Histogram getPresentationDelay() {
+        return histograms[PRESENTATION_DELAY];
+    }
+}
@@ -108,4 +108,30 @@ public interface AudioSpectrum {
      * @return array of float values.
      */
     public float[] getPhases(float[] phases);
+
+    /**
+     * Returns whether results are published without an
+     * <code>AudioSpectrumEvent</code>. Such spectra are read by calling
+     * {@link #pollUpdate(double[]) pollUpdate(double[])} periodically.
+     *
+     * @return boolean value
+     */
+    public default boolean isPolled() {
+        return false;
+    }
+
+    /**
+     * Takes a snapshot of the most recently published results if they changed
+     * since the previous call. The following calls to
+     * {@link #getMagnitudes(float[]) getMagnitudes(float[])} and
+     * {@link #getPhases(float[]) getPhases(float[])} return the snapshot, and
+     * its timestamp and duration in seconds are stored in
+     * <code>times[0]</code> and <code>times[1]</code>.
+     *
+     * @param times array of at least two elements receiving the timestamp and duration
+     * @return true if a new snapshot was taken
+     */
+    public default boolean pollUpdate(double[] times) {
+        return false;
+    }
 }
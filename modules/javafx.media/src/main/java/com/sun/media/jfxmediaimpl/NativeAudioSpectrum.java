@@ -26,20 +26,47 @@
 package com.sun.media.jfxmediaimpl;
 
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.Arrays;
 
 final class NativeAudioSpectrum implements AudioSpectrum {
-    private static final float[] EMPTY_FLOAT_ARRAY  = new float[0];
     public static final int      DEFAULT_THRESHOLD = -60;
     public static final int      DEFAULT_BANDS = 128;
     public static final double   DEFAULT_INTERVAL = 0.1;
 
+    /**
+     * Layout of the buffer shared with native code: a 32-bit sequence number
+     * padded to 8 bytes, followed by two slots. Each slot holds the timestamp
+     * and duration as doubles, then the magnitudes and phases. Native code
+     * writes the slot not covered by the current sequence and then increments
+     * it, so the most recent results live in slot {@code sequence & 1}.
+     */
+    private static final int     HEADER_SIZE = Long.BYTES;
+    private static final int     SLOT_HEADER_SIZE = 2 * Double.BYTES;
+    private static final int     MAX_READ_ATTEMPTS = 4;
+    private static final VarHandle SEQUENCE =
+            MethodHandles.byteBufferViewVarHandle(int[].class, ByteOrder.nativeOrder());
+
     /**
      * Handle to the native spectrum.
      */
     private final long nativeRef;
 
-    private float[] magnitudes = EMPTY_FLOAT_ARRAY;
-    private float[] phases = EMPTY_FLOAT_ARRAY;
+    /**
+     * Buffer currently registered with native code, or null.
+     */
+    private volatile SharedBands sharedBands;
+
+    /**
+     * True if native code publishes results without sending an
+     * {@code AudioSpectrumEvent}, so that callers poll with
+     * {@link #pollUpdate(double[])}.
+     */
+    private final boolean polled;
 
     //**************************************************************************
     //***** Constructors
@@ -48,13 +75,15 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     /**
      * Constructor.
      * @param refNativePlayer A reference to the native player.
+     * @param polled Whether results are published without events.
      */
-    NativeAudioSpectrum(long refMedia) {
+    NativeAudioSpectrum(long refMedia, boolean polled) {
         if (refMedia == 0) {
             throw new IllegalArgumentException("Invalid native media reference");
         }
 
         this.nativeRef = refMedia;
+        this.polled = polled;
         setBandCount(DEFAULT_BANDS);
     }
 
@@ -73,23 +102,29 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     @Override
     public int getBandCount() {
-        // just return the current size of one of the band arrays
-        return phases.length;
+        final SharedBands shared = sharedBands;
+        return shared != null ? shared.size : 0;
     }
 
     @Override
     public void setBandCount(int bands) {
         if (bands > 1) {
-            magnitudes = new float[bands];
-            for (int i = 0; i < magnitudes.length; i++) {
-                magnitudes[i] = (float)DEFAULT_THRESHOLD;//Float.NEGATIVE_INFINITY;
+            final int slotSize = SLOT_HEADER_SIZE + 2 * bands * Float.BYTES;
+            ByteBuffer buffer = ByteBuffer.allocateDirect(HEADER_SIZE + 2 * slotSize)
+                    .order(ByteOrder.nativeOrder());
+            SharedBands shared = new SharedBands(buffer, slotSize, bands);
+            for (int slot = 0; slot < 2; slot++) {
+                for (int i = 0; i < bands; i++) {
+                    buffer.putFloat(shared.bandsOffset(slot) + i * Float.BYTES,
+                            (float)DEFAULT_THRESHOLD);//Float.NEGATIVE_INFINITY;
+                }
             }
+            Arrays.fill(shared.magnitudes, (float)DEFAULT_THRESHOLD);
 
-            phases = new float[bands];
-            nativeSetBands(nativeRef, bands, magnitudes, phases);
+            sharedBands = shared;
+            nativeSetBands(nativeRef, bands, buffer);
         } else {
-            magnitudes = EMPTY_FLOAT_ARRAY;
-            phases = EMPTY_FLOAT_ARRAY;
+            sharedBands = null;
 
             throw new IllegalArgumentException("Number of bands must at least be 2");
         }
@@ -125,22 +160,141 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     @Override
     public float[] getMagnitudes(float[] mag) {
-        int size = magnitudes.length;
-        if(mag == null || mag.length < size) {
-            mag = new float[size];
-        }
-        System.arraycopy(magnitudes, 0, mag, 0, size);
-        return mag;
+        return readBands(mag, true);
     }
 
     @Override
     public float[] getPhases(float[] phs) {
-        int size = phases.length;
-        if(phs == null || phs.length < size) {
-            phs = new float[size];
+        return readBands(phs, false);
+    }
+
+    @Override
+    public boolean isPolled() {
+        return polled;
+    }
+
+    @Override
+    public boolean pollUpdate(double[] times) {
+        final SharedBands shared = sharedBands;
+        if (!polled || shared == null) {
+            return false;
+        }
+
+        synchronized (shared) {
+            int last = shared.sequence;
+            refresh(shared);
+            if (shared.sequence == last) {
+                return false;
+            }
+            times[0] = shared.timestamp;
+            times[1] = shared.duration;
+            return true;
+        }
+    }
+
+    /**
+     * Copies the magnitudes or phases of the last consistent snapshot. Polled
+     * spectra return the snapshot taken by {@link #pollUpdate(double[])}, so
+     * that both arrays and the times belong to the same update.
+     */
+    private float[] readBands(float[] dst, boolean magnitudes) {
+        final SharedBands shared = sharedBands;
+        final int size = shared != null ? shared.size : 0;
+        if (dst == null || dst.length < size) {
+            dst = new float[size];
+        }
+        if (size == 0) {
+            return dst;
+        }
+
+        synchronized (shared) {
+            if (!polled) {
+                refresh(shared);
+            }
+            System.arraycopy(magnitudes ? shared.magnitudes : shared.phases, 0, dst, 0, size);
+        }
+        return dst;
+    }
+
+    /**
+     * Updates the snapshot from the most recently published slot. The copy is
+     * retried if native code published again while it was in progress, since
+     * the next update reuses the slot being read. If every attempt races with
+     * an update the previous snapshot is kept, so callers never see a mix of
+     * two updates.
+     */
+    private static void refresh(SharedBands shared) {
+        final ByteBuffer buffer = shared.buffer;
+        final int size = shared.size;
+
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            int sequence = (int)SEQUENCE.getAcquire(buffer, 0);
+            if (sequence == shared.sequence) {
+                return;
+            }
+
+            int slot = sequence & 1;
+            double timestamp = buffer.getDouble(shared.slotOffset(slot));
+            double duration = buffer.getDouble(shared.slotOffset(slot) + Double.BYTES);
+            shared.data.get(shared.bandsIndex(slot), shared.scratchMagnitudes, 0, size);
+            shared.data.get(shared.bandsIndex(slot) + size, shared.scratchPhases, 0, size);
+            VarHandle.loadLoadFence();
+            if ((int)SEQUENCE.getAcquire(buffer, 0) == sequence) {
+                shared.swap(sequence, timestamp, duration);
+                return;
+            }
+        }
+    }
+
+    private static final class SharedBands {
+        final ByteBuffer buffer;
+        final FloatBuffer data;
+        final int slotSize;
+        final int size;
+
+        // Last consistent snapshot, guarded by this.
+        int sequence;
+        double timestamp;
+        double duration;
+        float[] magnitudes;
+        float[] phases;
+        float[] scratchMagnitudes;
+        float[] scratchPhases;
+
+        SharedBands(ByteBuffer buffer, int slotSize, int size) {
+            this.buffer = buffer;
+            this.data = buffer.duplicate().order(ByteOrder.nativeOrder()).asFloatBuffer();
+            this.slotSize = slotSize;
+            this.size = size;
+            this.magnitudes = new float[size];
+            this.phases = new float[size];
+            this.scratchMagnitudes = new float[size];
+            this.scratchPhases = new float[size];
+        }
+
+        int slotOffset(int slot) {
+            return HEADER_SIZE + slot * slotSize;
+        }
+
+        int bandsOffset(int slot) {
+            return slotOffset(slot) + SLOT_HEADER_SIZE;
+        }
+
+        int bandsIndex(int slot) {
+            return bandsOffset(slot) / Float.BYTES;
+        }
+
+        void swap(int sequence, double timestamp, double duration) {
+            float[] m = magnitudes;
+            float[] p = phases;
+            magnitudes = scratchMagnitudes;
+            phases = scratchPhases;
+            scratchMagnitudes = m;
+            scratchPhases = p;
+            this.sequence = sequence;
+            this.timestamp = timestamp;
+            this.duration = duration;
         }
-        System.arraycopy(phases, 0, phs, 0, size);
-        return phs;
     }
 
     //**************************************************************************
@@ -148,7 +302,7 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     //**************************************************************************
     private native boolean nativeGetEnabled(long nativeRef);
     private native void    nativeSetEnabled(long nativeRef, boolean enable);
-    private native void    nativeSetBands(long nativeRef, int bands, float[] magnitudes, float[] phases);
+    private native void    nativeSetBands(long nativeRef, int bands, ByteBuffer buffer);
     private native double  nativeGetInterval(long nativeRef);
     private native void    nativeSetInterval(long nativeRef, double interval);
     private native int     nativeGetThreshold(long nativeRef);
@@ -30,6 +30,7 @@ import com.sun.media.jfxmedia.Media;
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
 import com.sun.media.jfxmedia.MediaPlayer;
+import com.sun.media.jfxmedia.MediaPlayerMetrics;
 import com.sun.media.jfxmedia.control.VideoRenderControl;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
@@ -1023,6 +1024,16 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         return 0;
     }
 
+    @Override
+    public MediaPlayerMetrics getMetrics() {
+        try {
+            return playerGetMetrics();
+        } catch (MediaException me) {
+            sendPlayerEvent(new MediaErrorEvent(this, me.getMediaError()));
+        }
+        return null;
+    }
+
     @Override
     public void play() {
         try {
@@ -1274,6 +1285,14 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
 
     protected abstract void playerSetAudioSyncDelay(long delay) throws MediaException;
 
+    /**
+     * Returns the playback statistics of the player. Players that do not
+     * collect them return null.
+     */
+    protected MediaPlayerMetrics playerGetMetrics() throws MediaException {
+        return null;
+    }
+
     protected abstract void playerPlay() throws MediaException;
 
     protected abstract void playerStop() throws MediaException;
@@ -1694,7 +1713,15 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
     }
 
     protected AudioSpectrum createNativeAudioSpectrum(long nativeRef) {
-        return new NativeAudioSpectrum(nativeRef);
+        return createNativeAudioSpectrum(nativeRef, false);
+    }
+
+    /**
+     * Creates a spectrum whose native side publishes results without sending
+     * an {@code AudioSpectrumEvent} if {@code polled} is true.
+     */
+    protected AudioSpectrum createNativeAudioSpectrum(long nativeRef, boolean polled) {
+        return new NativeAudioSpectrum(nativeRef, polled);
     }
 }
 
@@ -27,6 +27,7 @@ package com.sun.media.jfxmediaimpl.platform.gstreamer;
 
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
+import com.sun.media.jfxmedia.MediaPlayerMetrics;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
 import com.sun.media.jfxmedia.locator.Locator;
@@ -55,7 +56,8 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
         }
 
         long mediaRef = gstMedia.getNativeMediaRef();
-        audioSpectrum = createNativeAudioSpectrum(gstGetAudioSpectrum(mediaRef));
+        // The spectrum element writes straight into the shared band buffer
+        audioSpectrum = createNativeAudioSpectrum(gstGetAudioSpectrum(mediaRef), true);
         audioEqualizer = createNativeAudioEqualizer(gstGetAudioEqualizer(mediaRef));
     }
 
@@ -96,6 +98,16 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
         return audioSyncDelay[0];
     }
 
+    @Override
+    protected MediaPlayerMetrics playerGetMetrics() throws MediaException {
+        long[] values = new long[MediaPlayerMetrics.SNAPSHOT_SIZE];
+        int rc = gstGetMetrics(gstMedia.getNativeMediaRef(), values);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+        return new MediaPlayerMetrics(values);
+    }
+
     @Override
     protected void playerSetAudioSyncDelay(long delay) throws MediaException {
         int rc = gstSetAudioSyncDelay(gstMedia.getNativeMediaRef(), delay);
@@ -284,6 +296,7 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     private native long gstGetAudioSpectrum(long refNativeMedia);
     private native int gstGetAudioSyncDelay(long refNativeMedia, long[] syncDelay);
     private native int gstSetAudioSyncDelay(long refNativeMedia, long delay);
+    private native int gstGetMetrics(long refNativeMedia, long[] values);
     private native int gstPlay(long refNativeMedia);
     private native int gstPause(long refNativeMedia);
     private native int gstStop(long refNativeMedia);
@@ -299,7 +299,7 @@ public final class MediaPlayer {
     private VideoTrackSizeListener sizeListener = null;
     private com.sun.media.jfxmedia.events.MediaErrorListener errorListener = null;
     private BufferListener bufferListener = null;
-    private com.sun.media.jfxmedia.events.AudioSpectrumListener spectrumListener = null;
+    private _SpectrumListener spectrumListener = null;
     private RendererListener rendererListener = null;
 
     // Store requested operations sent before we receive the onReady event
@@ -1486,6 +1486,10 @@ public final class MediaPlayer {
                         if (getOnPlaying() != null) {
                             Platform.runLater(getOnPlaying());
                         }
+                        if (getAudioSpectrumListener() != null) {
+                            // Start polling the spectrum
+                            Toolkit.getToolkit().requestNextPulse();
+                        }
                     } else if (get() == Status.PAUSED) {
                         if (getOnPaused() != null) {
                             Platform.runLater(getOnPaused());
@@ -2339,6 +2343,9 @@ public final class MediaPlayer {
                             if (playerReady) {
                                 boolean enabled = (audioSpectrumListener.get() != null);
                                 jfxPlayer.getAudioSpectrum().setEnabled(enabled);
+                                if (enabled) {
+                                    Toolkit.getToolkit().requestNextPulse();
+                                }
                             } else {
                                 audioSpectrumEnabledChangeRequested = true;
                             }
@@ -2652,6 +2659,7 @@ public final class MediaPlayer {
     private class _SpectrumListener implements com.sun.media.jfxmedia.events.AudioSpectrumListener {
         private float[] magnitudes;
         private float[] phases;
+        private final double[] times = new double[2];
 
         @Override public void onAudioSpectrumEvent(final AudioSpectrumEvent evt) {
             Platform.runLater(() -> {
@@ -2664,6 +2672,33 @@ public final class MediaPlayer {
                 }
             });
         }
+
+        /**
+         * Delivers results that the native spectrum published without an
+         * event. Called on every pulse, and keeps pulses coming while the
+         * player is playing and a listener is set.
+         */
+        void poll() {
+            AudioSpectrumListener listener = getAudioSpectrumListener();
+            com.sun.media.jfxmedia.MediaPlayer player = jfxPlayer;
+            if (listener == null || player == null) {
+                return;
+            }
+
+            AudioSpectrum spectrum = player.getAudioSpectrum();
+            if (spectrum == null || !spectrum.isPolled()) {
+                return;
+            }
+
+            if (spectrum.pollUpdate(times)) {
+                listener.spectrumDataUpdate(times[0], times[1],
+                        magnitudes = spectrum.getMagnitudes(magnitudes),
+                        phases = spectrum.getPhases(phases));
+            }
+            if (getStatus() == Status.PLAYING) {
+                Toolkit.getToolkit().requestNextPulse();
+            }
+        }
     }
 
     private final Object renderLock = new Object();
@@ -2736,6 +2771,11 @@ public final class MediaPlayer {
 
         @Override
         public void pulse() {
+            _SpectrumListener spectrum = spectrumListener;
+            if (null != spectrum) {
+                spectrum.poll();
+            }
+
             if (updateMediaViews) {
                 updateMediaViews = false;
 
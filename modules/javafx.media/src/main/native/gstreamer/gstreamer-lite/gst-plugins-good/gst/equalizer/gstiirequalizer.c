@@ -36,6 +36,36 @@
 
 #include "gst/glib-compat-private.h"
 
+#ifdef GSTREAMER_LITE
+/* Two double precision lanes, used to filter two channels at once. Double
+ * lanes keep the precision of the scalar code; 32-bit ARM NEON has no double
+ * vectors and stays on the scalar path. */
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IIR_EQU_SIMD 1
+typedef __m128d EquVec;
+#define equ_vec_set1(x) _mm_set1_pd (x)
+#define equ_vec_load(p) _mm_loadu_pd (p)
+#define equ_vec_store(p, v) _mm_storeu_pd (p, v)
+#define equ_vec_add(a, b) _mm_add_pd (a, b)
+#define equ_vec_mul(a, b) _mm_mul_pd (a, b)
+#elif defined (__aarch64__) && defined (__ARM_NEON)
+#include <arm_neon.h>
+#define IIR_EQU_SIMD 1
+typedef float64x2_t EquVec;
+#define equ_vec_set1(x) vdupq_n_f64 (x)
+#define equ_vec_load(p) vld1q_f64 (p)
+#define equ_vec_store(p, v) vst1q_f64 (p, v)
+#define equ_vec_add(a, b) vaddq_f64 (a, b)
+#define equ_vec_mul(a, b) vmulq_f64 (a, b)
+#endif
+#ifdef IIR_EQU_SIMD
+#define IIR_EQU_LANES 2
+/* frames filtered per pass, keeps the lane buffer (8 KB) on the stack */
+#define IIR_EQU_CHUNK_FRAMES 512
+#endif
+#endif // GSTREAMER_LITE
+
 GST_DEBUG_CATEGORY (equalizer_debug);
 #define GST_CAT_DEFAULT equalizer_debug
 
@@ -661,11 +691,21 @@ update_coefficients (GstIirEqualizer * equ)
 static void
 alloc_history (GstIirEqualizer * equ, const GstAudioInfo * info)
 {
+#ifdef IIR_EQU_SIMD
+  /* the vector path keeps history for whole groups of IIR_EQU_LANES channels */
+  guint channels = GST_AUDIO_INFO_CHANNELS (info);
+  channels = (channels + IIR_EQU_LANES - 1) / IIR_EQU_LANES * IIR_EQU_LANES;
+
+  g_free (equ->history);
+  equ->history =
+      g_malloc0 (equ->history_size * channels * equ->freq_band_count);
+#else // IIR_EQU_SIMD
   /* free + alloc = no memcpy */
   g_free (equ->history);
   equ->history =
       g_malloc0 (equ->history_size * GST_AUDIO_INFO_CHANNELS (info) *
       equ->freq_band_count);
+#endif // IIR_EQU_SIMD
 }
 
 void
@@ -861,6 +901,109 @@ CREATE_OPTIMIZED_FUNCTIONS_INT (gint16, gfloat, -32768.0, 32767.0);
 CREATE_OPTIMIZED_FUNCTIONS (gfloat);
 CREATE_OPTIMIZED_FUNCTIONS (gdouble);
 
+#ifdef IIR_EQU_SIMD
+/* Vector path for S16 and F32: each group of IIR_EQU_LANES channels is
+ * deinterleaved into the lanes of a chunk buffer and every band is run over
+ * the whole chunk before the next one, so each band's coefficients and history
+ * stay in registers. Cascading bands one after the other over a chunk computes
+ * the same thing as the per-sample cascade of the scalar code. */
+typedef struct {
+  gdouble x1[IIR_EQU_LANES], x2[IIR_EQU_LANES];
+  gdouble y1[IIR_EQU_LANES], y2[IIR_EQU_LANES];
+} SecondOrderHistoryLanes;
+
+static void
+gst_iir_equ_filter_lanes (GstIirEqualizer * equ,
+    SecondOrderHistoryLanes * history, gdouble * lanes, guint frames)
+{
+  guint i, f, nf = equ->freq_band_count;
+  GstIirEqualizerBand **filters = equ->bands;
+
+  for (f = 0; f < nf; f++, history++) {
+    GstIirEqualizerBand *filter = filters[f];
+    const EquVec a0 = equ_vec_set1 (filter->a0);
+    const EquVec a1 = equ_vec_set1 (filter->a1);
+    const EquVec a2 = equ_vec_set1 (filter->a2);
+    const EquVec b1 = equ_vec_set1 (filter->b1);
+    const EquVec b2 = equ_vec_set1 (filter->b2);
+    EquVec x1 = equ_vec_load (history->x1);
+    EquVec x2 = equ_vec_load (history->x2);
+    EquVec y1 = equ_vec_load (history->y1);
+    EquVec y2 = equ_vec_load (history->y2);
+    gdouble *p = lanes;
+
+    for (i = 0; i < frames; i++, p += IIR_EQU_LANES) {
+      EquVec input = equ_vec_load (p);
+      EquVec output = equ_vec_mul (a0, input);
+      output = equ_vec_add (output, equ_vec_mul (a1, x1));
+      output = equ_vec_add (output, equ_vec_mul (a2, x2));
+      output = equ_vec_add (output, equ_vec_mul (b1, y1));
+      output = equ_vec_add (output, equ_vec_mul (b2, y2));
+      x2 = x1;
+      x1 = input;
+      y2 = y1;
+      y1 = output;
+      equ_vec_store (p, output);
+    }
+
+    equ_vec_store (history->x1, x1);
+    equ_vec_store (history->x2, x2);
+    equ_vec_store (history->y1, y1);
+    equ_vec_store (history->y2, y2);
+  }
+}
+
+#define CREATE_SIMD_FUNCTIONS(TYPE,TO_TYPE)                             \
+static void                                                             \
+gst_iir_equ_process_ ## TYPE ## _simd (GstIirEqualizer *equ,            \
+    guint8 *data, guint size, guint channels)                           \
+{                                                                       \
+  gdouble lanes[IIR_EQU_CHUNK_FRAMES * IIR_EQU_LANES];                  \
+  guint frames = size / channels / sizeof (TYPE);                       \
+  guint nf = equ->freq_band_count;                                      \
+  guint start, count, group, n, i, c;                                   \
+                                                                        \
+  for (start = 0; start < frames; start += count) {                     \
+    TYPE *chunk = ((TYPE *) data) + start * channels;                   \
+    count = MIN (frames - start, IIR_EQU_CHUNK_FRAMES);                 \
+                                                                        \
+    for (group = 0; group < channels; group += IIR_EQU_LANES) {         \
+      SecondOrderHistoryLanes *history =                                \
+          ((SecondOrderHistoryLanes *) equ->history) +                  \
+          (group / IIR_EQU_LANES) * nf;                                 \
+      n = MIN (channels - group, IIR_EQU_LANES);                        \
+                                                                        \
+      if (n < IIR_EQU_LANES)                                            \
+        memset (lanes, 0, count * IIR_EQU_LANES * sizeof (gdouble));    \
+      for (i = 0; i < count; i++)                                       \
+        for (c = 0; c < n; c++)                                         \
+          lanes[i * IIR_EQU_LANES + c] = chunk[i * channels + group + c];\
+                                                                        \
+      gst_iir_equ_filter_lanes (equ, history, lanes, count);            \
+                                                                        \
+      for (i = 0; i < count; i++)                                       \
+        for (c = 0; c < n; c++)                                         \
+          chunk[i * channels + group + c] =                             \
+              TO_TYPE (lanes[i * IIR_EQU_LANES + c]);                   \
+    }                                                                   \
+  }                                                                     \
+}
+
+#define GINT16_FROM_LANE(v) ((gint16) floor (CLAMP ((v), -32768.0, 32767.0)))
+#define GFLOAT_FROM_LANE(v) ((gfloat) (v))
+
+CREATE_SIMD_FUNCTIONS (gint16, GINT16_FROM_LANE);
+CREATE_SIMD_FUNCTIONS (gfloat, GFLOAT_FROM_LANE);
+
+/* The scalar S16 and F32 functions are still built when the vector path is
+ * used. They are the reference for iirequalizer-check.c and this keeps them
+ * compiling on every target. */
+static const ProcessFunc gst_iir_equ_scalar_process[] G_GNUC_UNUSED = {
+  gst_iir_equ_process_gint16,
+  gst_iir_equ_process_gfloat
+};
+#endif // IIR_EQU_SIMD
+
 static GstFlowReturn
 gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
 {
@@ -914,6 +1057,16 @@ gst_iir_equalizer_setup (GstAudioFilter * audio, const GstAudioInfo * info)
   GstIirEqualizer *equ = GST_IIR_EQUALIZER (audio);
 
   switch (GST_AUDIO_INFO_FORMAT (info)) {
+#ifdef IIR_EQU_SIMD
+    case GST_AUDIO_FORMAT_S16:
+      equ->history_size = sizeof (SecondOrderHistoryLanes) / IIR_EQU_LANES;
+      equ->process = gst_iir_equ_process_gint16_simd;
+      break;
+    case GST_AUDIO_FORMAT_F32:
+      equ->history_size = sizeof (SecondOrderHistoryLanes) / IIR_EQU_LANES;
+      equ->process = gst_iir_equ_process_gfloat_simd;
+      break;
+#else // IIR_EQU_SIMD
     case GST_AUDIO_FORMAT_S16:
       equ->history_size = history_size_gint16;
       equ->process = gst_iir_equ_process_gint16;
@@ -922,6 +1075,7 @@ gst_iir_equalizer_setup (GstAudioFilter * audio, const GstAudioInfo * info)
       equ->history_size = history_size_gfloat;
       equ->process = gst_iir_equ_process_gfloat;
       break;
+#endif // IIR_EQU_SIMD
     case GST_AUDIO_FORMAT_F64:
       equ->history_size = history_size_gdouble;
       equ->process = gst_iir_equ_process_gdouble;
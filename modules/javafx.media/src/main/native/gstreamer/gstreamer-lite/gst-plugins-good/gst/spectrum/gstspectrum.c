@@ -97,7 +97,13 @@ enum
   PROP_INTERVAL,
   PROP_BANDS,
   PROP_THRESHOLD,
+#ifdef GSTREAMER_LITE
+  PROP_MULTI_CHANNEL,
+  PROP_BANDS_CALLBACK,
+  PROP_BANDS_CALLBACK_DATA
+#else // GSTREAMER_LITE
   PROP_MULTI_CHANNEL
+#endif // GSTREAMER_LITE
 };
 
 #define gst_spectrum_parent_class parent_class
@@ -198,6 +204,18 @@ gst_spectrum_class_init (GstSpectrumClass * klass)
           "Send separate results for each channel",
           DEFAULT_MULTI_CHANNEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+#ifdef GSTREAMER_LITE
+  g_object_class_install_property (gobject_class, PROP_BANDS_CALLBACK,
+      g_param_spec_pointer ("bands-callback", "Bands callback",
+          "GstSpectrumBandsCallbackProc called instead of posting messages",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_BANDS_CALLBACK_DATA,
+      g_param_spec_pointer ("bands-callback-data", "Bands callback data",
+          "User data passed to the bands callback",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+#endif // GSTREAMER_LITE
+
   GST_DEBUG_CATEGORY_INIT (gst_spectrum_debug, "spectrum", 0,
       "audio spectrum analyser element");
 
@@ -223,6 +241,11 @@ gst_spectrum_init (GstSpectrum * spectrum)
   spectrum->bands = DEFAULT_BANDS;
   spectrum->threshold = DEFAULT_THRESHOLD;
 
+#ifdef GSTREAMER_LITE
+  spectrum->bands_callback = NULL;
+  spectrum->bands_callback_data = NULL;
+#endif // GSTREAMER_LITE
+
 #if defined (GSTREAMER_LITE) && defined (OSX)
   spectrum->bps_user = 0;
   spectrum->bpf_user = 0;
@@ -367,6 +390,21 @@ gst_spectrum_set_property (GObject * object, guint prop_id,
       g_mutex_unlock (&filter->lock);
       break;
     }
+#ifdef GSTREAMER_LITE
+    // Taking the lock guarantees that no callback is running once the
+    // property is cleared.
+    case PROP_BANDS_CALLBACK:
+      g_mutex_lock (&filter->lock);
+      filter->bands_callback =
+          (GstSpectrumBandsCallbackProc) g_value_get_pointer (value);
+      g_mutex_unlock (&filter->lock);
+      break;
+    case PROP_BANDS_CALLBACK_DATA:
+      g_mutex_lock (&filter->lock);
+      filter->bands_callback_data = g_value_get_pointer (value);
+      g_mutex_unlock (&filter->lock);
+      break;
+#endif // GSTREAMER_LITE
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -401,6 +439,14 @@ gst_spectrum_get_property (GObject * object, guint prop_id,
     case PROP_MULTI_CHANNEL:
       g_value_set_boolean (value, filter->multi_channel);
       break;
+#ifdef GSTREAMER_LITE
+    case PROP_BANDS_CALLBACK:
+      g_value_set_pointer (value, (gpointer) filter->bands_callback);
+      break;
+    case PROP_BANDS_CALLBACK_DATA:
+      g_value_set_pointer (value, filter->bands_callback_data);
+      break;
+#endif // GSTREAMER_LITE
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1015,6 +1061,15 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
           gst_spectrum_prepare_message_data (spectrum, cd);
         }
 
+#ifdef GSTREAMER_LITE
+        if (spectrum->bands_callback != NULL && !spectrum->multi_channel) {
+          // Hand the averages over directly, no message is built or posted.
+          cd = &spectrum->channel_data[0];
+          spectrum->bands_callback (spectrum, spectrum->message_ts,
+              spectrum->interval, spectrum->bands, cd->spect_magnitude,
+              cd->spect_phase, spectrum->bands_callback_data);
+        } else {
+#endif // GSTREAMER_LITE
         m = gst_spectrum_message_new (spectrum, spectrum->message_ts,
             spectrum->interval);
 
@@ -1027,6 +1082,9 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
 #else // GSTREAMER_LITE && OSX
         gst_element_post_message (GST_ELEMENT (spectrum), m);
 #endif // GSTREAMER_LITE && OSX
+#ifdef GSTREAMER_LITE
+        }
+#endif // GSTREAMER_LITE
 #ifndef GSTREAMER_LITE
       }
 #endif // GSTREAMER_LITE
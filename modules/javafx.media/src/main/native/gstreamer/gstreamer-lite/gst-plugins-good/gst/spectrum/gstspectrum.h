@@ -49,6 +49,19 @@ typedef gboolean (*PostMessageCallbackProc)(GstElement * element,
                                             GstMessage * message);
 #endif // GSTREAMER_LITE and OSX
 
+#ifdef GSTREAMER_LITE
+// Set through the "bands-callback" property to receive averaged results on the
+// streaming thread instead of an element message. Magnitudes are in dB, times
+// are in nanoseconds. Only used when multi-channel is off.
+typedef void (*GstSpectrumBandsCallbackProc)(GstSpectrum * spectrum,
+                                             GstClockTime timestamp,
+                                             GstClockTime duration,
+                                             guint bands,
+                                             const gfloat * magnitudes,
+                                             const gfloat * phases,
+                                             gpointer user_data);
+#endif // GSTREAMER_LITE
+
 struct _GstSpectrumChannel
 {
   gfloat *input;
@@ -91,6 +104,11 @@ struct _GstSpectrum
 
   GstSpectrumInputData input_data;
 
+#ifdef GSTREAMER_LITE
+  GstSpectrumBandsCallbackProc bands_callback;
+  gpointer bands_callback_data;
+#endif // GSTREAMER_LITE
+
 #if defined (GSTREAMER_LITE) && defined (OSX)
   guint bps_user; // User provided values to avoid more complex spectrum initialization
   guint bpf_user;
@@ -37,7 +37,33 @@ GST_DEBUG_CATEGORY (hls_progress_buffer_debug);
 /***********************************************************************************
  * Element structures are hidden from outside
  ***********************************************************************************/
-#define NUM_OF_CACHED_SEGMENTS 3
+// Segments are kept in memory as lists of GstBuffers. The ring has room for
+// MAX_CACHED_SEGMENTS, but only prefetch_segments of them are filled ahead of
+// the reader; that number adapts to the measured download and playback rates.
+// A segment that would push the memory held by the ring above
+// SEGMENT_MEMORY_BUDGET is written to a disk cache instead.
+#define MAX_CACHED_SEGMENTS     8
+#define MIN_PREFETCH_SEGMENTS   2
+#define DEFAULT_PREFETCH_SEGMENTS 3
+#define SEGMENT_MEMORY_BUDGET   (16 * 1024 * 1024)
+
+// Prefetch more when downloads are less than this many times faster than playback
+#define PREFETCH_GROW_RATIO     1.5
+// Prefetch less when downloads are more than this many times faster than playback
+#define PREFETCH_SHRINK_RATIO   4.0
+
+typedef struct _HLSSegment
+{
+    GQueue        buffers;         // In-memory data, unused if cache is set
+    Cache*        cache;           // Disk cache, created on first spill
+    gboolean      on_disk;
+    guint64       size;
+    guint64       write_position;
+    guint64       read_position;
+    gboolean      write_ready;
+    gint64        write_start_time;
+    gint64        read_start_time;
+} HLSSegment;
 
 struct _HLSProgressBuffer
 {
@@ -50,11 +76,16 @@ struct _HLSProgressBuffer
     GCond        add_cond;
     GCond        del_cond;
 
-    Cache*        cache[NUM_OF_CACHED_SEGMENTS];
-    guint         cache_size[NUM_OF_CACHED_SEGMENTS];
-    gboolean      cache_write_ready[NUM_OF_CACHED_SEGMENTS];
+    HLSSegment    segments[MAX_CACHED_SEGMENTS];
     gint          cache_write_index;
     gint          cache_read_index;
+    guint         queued_segments;   // Segments claimed by the writer and not fully read
+    guint         prefetch_segments;
+    guint64       memory_reserved;   // Bytes reserved by in-memory segments
+
+    gdouble       download_rate;     // Bytes per second, moving average
+    gdouble       playback_rate;     // Bytes per second, moving average
+    gboolean      reader_starved;    // Reader waited for data since last adjustment
 
     gboolean      send_new_segment;
     gboolean      set_src_caps;
@@ -125,6 +156,7 @@ static gboolean             hls_progress_buffer_activatepush_src(GstPad *pad, Gs
 static gboolean             hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, GstEvent *event);
 static void                 hls_progress_buffer_loop(void *data);
 static void                 hls_progress_buffer_flush_data(HLSProgressBuffer *buffer);
+static void                 hls_segment_reset(HLSSegment *segment);
 
 /**
  * hls_progress_buffer_class_init()
@@ -176,15 +208,22 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
     g_cond_init(&element->add_cond);
     g_cond_init(&element->del_cond);
 
-    for (i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
+    for (i = 0; i < MAX_CACHED_SEGMENTS; i++)
     {
-        element->cache[i] = create_cache();
-        element->cache_size[i] = 0;
-        element->cache_write_ready[i] = TRUE;
+        g_queue_init(&element->segments[i].buffers);
+        element->segments[i].cache = NULL;
+        hls_segment_reset(&element->segments[i]);
     }
 
     element->cache_write_index = -1;
     element->cache_read_index = 0;
+    element->queued_segments = 0;
+    element->prefetch_segments = DEFAULT_PREFETCH_SEGMENTS;
+    element->memory_reserved = 0;
+
+    element->download_rate = 0.0;
+    element->playback_rate = 0.0;
+    element->reader_starved = FALSE;
 
     element->send_new_segment = TRUE;
     element->set_src_caps = TRUE;
@@ -207,10 +246,11 @@ static void hls_progress_buffer_finalize (GObject *object)
     HLSProgressBuffer *element = HLS_PROGRESS_BUFFER(object);
     int i = 0;
 
-    for (i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
+    for (i = 0; i < MAX_CACHED_SEGMENTS; i++)
     {
-        if (element->cache[i])
-            destroy_cache(element->cache[i]);
+        hls_segment_reset(&element->segments[i]);
+        if (element->segments[i].cache)
+            destroy_cache(element->segments[i].cache);
     }
 
     g_mutex_clear(&element->lock);
@@ -285,18 +325,102 @@ static void hls_progress_buffer_flush_data(HLSProgressBuffer *element)
 
     element->cache_write_index = -1;
     element->cache_read_index = 0;
-    for (i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
+    for (i = 0; i < MAX_CACHED_SEGMENTS; i++)
+        hls_segment_reset(&element->segments[i]);
+    element->queued_segments = 0;
+    element->memory_reserved = 0;
+    element->reader_starved = FALSE;
+
+    g_mutex_unlock(&element->lock);
+}
+
+/**
+ * hls_segment_reset()
+ *
+ * Drops any data held by the segment and marks it free for writing.
+ */
+static void hls_segment_reset(HLSSegment *segment)
+{
+    GstBuffer *buffer = NULL;
+
+    while ((buffer = (GstBuffer*)g_queue_pop_head(&segment->buffers)) != NULL)
+        gst_buffer_unref(buffer);
+
+    if (segment->cache)
     {
-        if (element->cache[i])
-        {
-            cache_set_write_position(element->cache[i], 0);
-            cache_set_read_position(element->cache[i], 0);
-            element->cache_size[i] = 0;
-            element->cache_write_ready[i] = TRUE;
-        }
+        cache_set_write_position(segment->cache, 0);
+        cache_set_read_position(segment->cache, 0);
     }
 
-    g_mutex_unlock(&element->lock);
+    segment->on_disk = FALSE;
+    segment->size = 0;
+    segment->write_position = 0;
+    segment->read_position = 0;
+    segment->write_ready = TRUE;
+    segment->write_start_time = 0;
+    segment->read_start_time = 0;
+}
+
+/**
+ * hls_segment_has_data()
+ *
+ * Returns TRUE if the segment has data which was not read yet.
+ */
+static gboolean hls_segment_has_data(HLSSegment *segment)
+{
+    if (segment->on_disk)
+        return cache_has_enough_data(segment->cache);
+    else
+        return !g_queue_is_empty(&segment->buffers);
+}
+
+/**
+ * update_rate()
+ *
+ * Folds a new measurement of bytes over microseconds into a moving average.
+ */
+static void update_rate(gdouble *rate, guint64 bytes, gint64 elapsed)
+{
+    gdouble sample;
+
+    if (bytes == 0 || elapsed <= 0)
+        return;
+
+    sample = (gdouble)bytes * G_USEC_PER_SEC / elapsed;
+    *rate = (*rate > 0.0) ? (*rate * 0.7 + sample * 0.3) : sample;
+}
+
+/**
+ * update_prefetch_segments()
+ *
+ * Called with the lock held each time a segment finished downloading. Grows the
+ * number of prefetched segments when downloads barely keep up with playback or
+ * the reader had to wait, and shrinks it when the network is well ahead.
+ */
+static void update_prefetch_segments(HLSProgressBuffer *element)
+{
+    gdouble ratio = 0.0;
+
+    if (element->download_rate <= 0.0 || element->playback_rate <= 0.0)
+        return;
+
+    ratio = element->download_rate / element->playback_rate;
+
+    if ((element->reader_starved || ratio < PREFETCH_GROW_RATIO) &&
+        element->prefetch_segments < MAX_CACHED_SEGMENTS)
+    {
+        element->prefetch_segments++;
+    }
+    else if (!element->reader_starved && ratio > PREFETCH_SHRINK_RATIO &&
+             element->prefetch_segments > MIN_PREFETCH_SEGMENTS)
+    {
+        element->prefetch_segments--;
+    }
+
+    element->reader_starved = FALSE;
+
+    GST_DEBUG_OBJECT(element, "download %.0f B/s, playback %.0f B/s, prefetch %u segments",
+                     element->download_rate, element->playback_rate, element->prefetch_segments);
 }
 
 /***********************************************************************************
@@ -320,15 +444,41 @@ static GstFlowReturn hls_progress_buffer_chain(GstPad *pad, GstObject *parent, G
     }
 
     g_mutex_lock(&element->lock);
-    if (element->srcresult != GST_FLOW_FLUSHING)
+    if (element->srcresult != GST_FLOW_FLUSHING && element->cache_write_index >= 0)
     {
-        cache_write_buffer(element->cache[element->cache_write_index], data);
+        HLSSegment *segment = &element->segments[element->cache_write_index];
+        guint64 size = gst_buffer_get_size(data);
+
+        if (segment->write_start_time == 0)
+            segment->write_start_time = g_get_monotonic_time();
+
+        if (segment->on_disk)
+        {
+            cache_write_buffer(segment->cache, data);
+        }
+        else
+        {
+            // Keep the reference, the reader pushes the same buffer downstream
+            g_queue_push_tail(&segment->buffers, data);
+            data = NULL;
+        }
+
+        segment->write_position += size;
+        if (segment->size > 0 && segment->write_position >= segment->size &&
+            segment->write_position - size < segment->size)
+        {
+            update_rate(&element->download_rate, segment->write_position,
+                        g_get_monotonic_time() - segment->write_start_time);
+            update_prefetch_segments(element);
+        }
+
         g_cond_signal(&element->add_cond);
     }
     g_mutex_unlock(&element->lock);
 
     // INLINE - gst_buffer_unref()
-    gst_buffer_unref(data);
+    if (data)
+        gst_buffer_unref(data);
 
     return result;
 }
@@ -393,7 +543,7 @@ static void hls_progress_buffer_loop(void *data)
 
     g_mutex_lock(&element->lock);
 
-    while (element->srcresult == GST_FLOW_OK && !cache_has_enough_data(element->cache[element->cache_read_index]))
+    while (element->srcresult == GST_FLOW_OK && !hls_segment_has_data(&element->segments[element->cache_read_index]))
     {
         if (element->is_eos)
         {
@@ -404,6 +554,8 @@ static void hls_progress_buffer_loop(void *data)
 
         if (!element->is_eos)
         {
+            if (element->segments[element->cache_read_index].read_position > 0 || element->queued_segments > 0)
+                element->reader_starved = TRUE;
             g_cond_wait(&element->add_cond, &element->lock);
         }
     }
@@ -412,13 +564,38 @@ static void hls_progress_buffer_loop(void *data)
 
     if (result == GST_FLOW_OK)
     {
+        HLSSegment *segment = &element->segments[element->cache_read_index];
         GstBuffer *buffer = NULL;
-        guint64 read_position = cache_read_buffer(element->cache[element->cache_read_index], &buffer);
+        guint64 read_position = 0;
+
+        if (segment->read_start_time == 0)
+            segment->read_start_time = g_get_monotonic_time();
+
+        if (segment->on_disk)
+        {
+            read_position = cache_read_buffer(segment->cache, &buffer);
+        }
+        else
+        {
+            // Timestamps and offsets are reset to match buffers read back from a cache
+            buffer = gst_buffer_make_writable((GstBuffer*)g_queue_pop_head(&segment->buffers));
+            GST_BUFFER_PTS(buffer) = GST_CLOCK_TIME_NONE;
+            GST_BUFFER_DTS(buffer) = GST_CLOCK_TIME_NONE;
+            GST_BUFFER_DURATION(buffer) = GST_CLOCK_TIME_NONE;
+            GST_BUFFER_OFFSET(buffer) = segment->read_position;
+            read_position = segment->read_position + gst_buffer_get_size(buffer);
+        }
+        segment->read_position = read_position;
 
-        if (read_position == element->cache_size[element->cache_read_index])
+        if (read_position == segment->size)
         {
-            element->cache_write_ready[element->cache_read_index] = TRUE;
-            element->cache_read_index = (element->cache_read_index + 1) % NUM_OF_CACHED_SEGMENTS;
+            update_rate(&element->playback_rate, segment->size,
+                        g_get_monotonic_time() - segment->read_start_time);
+            if (!segment->on_disk)
+                element->memory_reserved -= segment->size;
+            hls_segment_reset(segment);
+            element->queued_segments--;
+            element->cache_read_index = (element->cache_read_index + 1) % MAX_CACHED_SEGMENTS;
             send_hls_not_full_message(element);
             g_cond_signal(&element->del_cond);
         }
@@ -519,9 +696,11 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
 
             // Get and prepare next write segment
             g_mutex_lock(&element->lock);
-            element->cache_write_index = (element->cache_write_index + 1) % NUM_OF_CACHED_SEGMENTS;
+            element->cache_write_index = (element->cache_write_index + 1) % MAX_CACHED_SEGMENTS;
 
-            while (element->srcresult == GST_FLOW_OK && !element->cache_write_ready[element->cache_write_index])
+            while (element->srcresult == GST_FLOW_OK &&
+                   (!element->segments[element->cache_write_index].write_ready ||
+                    element->queued_segments >= element->prefetch_segments))
             {
                 g_mutex_unlock(&element->lock);
                 send_hls_full_message(element);
@@ -533,10 +712,25 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
                     return TRUE;
                 }
             }
-            element->cache_size[element->cache_write_index] = segment.stop;
-            element->cache_write_ready[element->cache_write_index] = FALSE;
-            cache_set_write_position(element->cache[element->cache_write_index], 0);
-            cache_set_read_position(element->cache[element->cache_write_index], 0);
+            {
+                HLSSegment *next = &element->segments[element->cache_write_index];
+
+                hls_segment_reset(next);
+                next->size = segment.stop;
+                next->write_ready = FALSE;
+
+                // Spill to disk only when keeping this segment in memory would exceed the budget
+                if (element->memory_reserved + next->size > SEGMENT_MEMORY_BUDGET)
+                {
+                    if (next->cache == NULL)
+                        next->cache = create_cache();
+                    next->on_disk = (next->cache != NULL);
+                }
+
+                if (!next->on_disk)
+                    element->memory_reserved += next->size;
+                element->queued_segments++;
+            }
 
             g_mutex_unlock(&element->lock);
 
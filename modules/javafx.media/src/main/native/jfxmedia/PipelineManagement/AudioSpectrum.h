@@ -42,8 +42,14 @@ public:
     static CBandsHolder* AddRef(CBandsHolder* holder);
     static void          ReleaseRef(CBandsHolder* holder);
 
+    // Same as UpdateBands(), but also records when the results were taken.
+    // Times are in seconds.
+    virtual void PublishBands(double timestamp, double duration, int size,
+                              const float* magnitudes, const float* phases) = 0;
+
 protected:
     static void          InitRef(CBandsHolder* holder);
+    static void          PublishSequence(volatile int* sequence, int value);
 
 private:
     volatile int m_RefCounter;
@@ -45,7 +45,8 @@ CPipeline::CPipeline(CPipelineOptions* pOptions)
     m_bStaticPipeline(true),
     m_bDynamicElementsReady(false),
     m_bAudioSinkReady(false),
-    m_bVideoSinkReady(false)
+    m_bVideoSinkReady(false),
+    m_pMetrics(CPipelineMetrics::Create())
 {
 }
 
@@ -58,6 +59,8 @@ CPipeline::~CPipeline()
 
     if (NULL != m_pEventDispatcher)
         delete m_pEventDispatcher;
+
+    CPipelineMetrics::Release(m_pMetrics);
 }
 
 void CPipeline::SetEventDispatcher(CPlayerEventDispatcher* pEventDispatcher)
@@ -193,3 +196,8 @@ CAudioSpectrum* CPipeline::GetAudioSpectrum()
 {
     return NULL;
 }
+
+CPipelineMetrics* CPipeline::GetMetrics()
+{
+    return m_pMetrics;
+}
@@ -32,6 +32,7 @@
 #include "PipelineOptions.h"
 #include "AudioEqualizer.h"
 #include "AudioSpectrum.h"
+#include "PipelineMetrics.h"
 #include <MediaManagement/MediaWarningListener.h>
 
 class CMedia;
@@ -91,6 +92,8 @@ public:
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
+    CPipelineMetrics*       GetMetrics();
+
     CPlayerEventDispatcher* m_pEventDispatcher;
 
 protected:
@@ -107,6 +110,7 @@ protected:
     bool                    m_bDynamicElementsReady;
     bool                    m_bAudioSinkReady;
     bool                    m_bVideoSinkReady;
+    CPipelineMetrics*       m_pMetrics;
 };
 
 #endif  //_PIPELINE_H_
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "PipelineMetrics.h"
+#include <Common/VSMemory.h>
+#include <gst/gst.h>
+#include <new>
+
+//*************************************************************************************************
+//********** class CPipelineMetrics
+//*************************************************************************************************
+CPipelineMetrics::CPipelineMetrics()
+:   m_RefCount(1)
+{
+    for (int i = 0; i < COUNTER_COUNT; i++)
+        m_Counters[i] = 0;
+
+    for (int h = 0; h < HISTOGRAM_COUNT; h++)
+    {
+        for (int b = 0; b < BUCKET_COUNT; b++)
+            m_Buckets[h][b] = 0;
+        m_Samples[h] = 0;
+        m_Max[h] = 0;
+    }
+}
+
+CPipelineMetrics* CPipelineMetrics::Create()
+{
+    return new(std::nothrow) CPipelineMetrics();
+}
+
+CPipelineMetrics* CPipelineMetrics::AddRef(CPipelineMetrics* pMetrics)
+{
+    if (pMetrics != NULL)
+        g_atomic_int_inc(&pMetrics->m_RefCount);
+    return pMetrics;
+}
+
+void CPipelineMetrics::Release(CPipelineMetrics* pMetrics)
+{
+    if (pMetrics != NULL && g_atomic_int_dec_and_test(&pMetrics->m_RefCount))
+        delete pMetrics;
+}
+
+/**
+ * CPipelineMetrics::Now()
+ *
+ * Returns the monotonic time in microseconds used for all measurements.
+ */
+int64_t CPipelineMetrics::Now()
+{
+    return g_get_monotonic_time();
+}
+
+/**
+ * CPipelineMetrics::Increment()
+ *
+ * Adds one to a counter.
+ */
+void CPipelineMetrics::Increment(Counter counter)
+{
+    g_atomic_int_inc(&m_Counters[counter]);
+}
+
+/**
+ * CPipelineMetrics::Add()
+ *
+ * Adds delta to a counter.
+ */
+void CPipelineMetrics::Add(Counter counter, int64_t delta)
+{
+    delta = CLAMP(delta, G_MININT, G_MAXINT);
+    g_atomic_int_add(&m_Counters[counter], (gint)delta);
+}
+
+/**
+ * CPipelineMetrics::Set()
+ *
+ * Sets a counter that holds a current value rather than a count, such as
+ * AV_DRIFT_MICROS. The value is clamped to the int range.
+ */
+void CPipelineMetrics::Set(Counter counter, int64_t value)
+{
+    value = CLAMP(value, G_MININT, G_MAXINT);
+    g_atomic_int_set(&m_Counters[counter], (int)value);
+}
+
+/**
+ * CPipelineMetrics::Record()
+ *
+ * Adds a sample in microseconds to a histogram. Negative samples are counted
+ * as zero.
+ */
+void CPipelineMetrics::Record(Histogram histogram, int64_t micros)
+{
+    int bucket = 0;
+    int value = 0;
+
+    if (micros < 0)
+        micros = 0;
+    value = (int)MIN(micros, (int64_t)G_MAXINT);
+
+    while (bucket < BUCKET_COUNT - 1 && (micros >= ((int64_t)HISTOGRAM_BASE_MICROS << bucket)))
+        bucket++;
+
+    g_atomic_int_inc(&m_Buckets[histogram][bucket]);
+    g_atomic_int_inc(&m_Samples[histogram]);
+
+    // Lock-free maximum, retried only while another thread raises it concurrently
+    int max = g_atomic_int_get(&m_Max[histogram]);
+    while (value > max && !g_atomic_int_compare_and_exchange(&m_Max[histogram], max, value))
+        max = g_atomic_int_get(&m_Max[histogram]);
+}
+
+/**
+ * CPipelineMetrics::Snapshot()
+ *
+ * Copies all counters and histograms into pValues, which must hold
+ * SNAPSHOT_SIZE values. Values are read one at a time, so a snapshot taken
+ * while streaming may mix updates that happened during the copy.
+ */
+void CPipelineMetrics::Snapshot(int64_t* pValues) const
+{
+    CPipelineMetrics* pThis = const_cast<CPipelineMetrics*>(this);
+    int index = 0;
+
+    for (int i = 0; i < COUNTER_COUNT; i++)
+        pValues[index++] = g_atomic_int_get(&pThis->m_Counters[i]);
+
+    for (int h = 0; h < HISTOGRAM_COUNT; h++)
+    {
+        for (int b = 0; b < BUCKET_COUNT; b++)
+            pValues[index++] = g_atomic_int_get(&pThis->m_Buckets[h][b]);
+        pValues[index++] = g_atomic_int_get(&pThis->m_Samples[h]);
+        pValues[index++] = g_atomic_int_get(&pThis->m_Max[h]);
+    }
+}
+
+//*************************************************************************************************
+//********** class CFrameStamps
+//*************************************************************************************************
+CFrameStamps::CFrameStamps()
+:   m_Next(0)
+{
+    for (int i = 0; i < STAMP_COUNT; i++)
+    {
+        m_Slots[i].state = SLOT_EMPTY;
+        m_Slots[i].timestamp = 0;
+        m_Slots[i].time = 0;
+    }
+}
+
+/**
+ * CFrameStamps::Stamp()
+ *
+ * Records that the buffer with the given timestamp passed at time now,
+ * overwriting the oldest stamp. Must only be called from one thread at a time.
+ */
+void CFrameStamps::Stamp(int64_t timestamp, int64_t now)
+{
+    Slot *pSlot = &m_Slots[m_Next];
+    int state, writing;
+
+    // Mark the slot as being written under a new generation. Readers can only
+    // move a valid stamp to empty, so this retries at most a few times.
+    do {
+        state = g_atomic_int_get(&pSlot->state);
+        writing = (int)(((unsigned)state & ~(unsigned)SLOT_STATE_MASK) + SLOT_GENERATION);
+    } while (!g_atomic_int_compare_and_exchange(&pSlot->state, state, writing | SLOT_WRITING));
+
+    pSlot->timestamp = timestamp;
+    pSlot->time = now;
+
+    // Full barrier, the stamp is complete before the slot is seen as valid
+    g_atomic_int_set(&pSlot->state, writing | SLOT_VALID);
+
+    m_Next = (m_Next + 1) % STAMP_COUNT;
+}
+
+/**
+ * CFrameStamps::Take()
+ *
+ * Finds the stamp of the buffer with the given timestamp, returns when it was
+ * recorded in pStampTime and forgets it. Returns false if there is no such
+ * stamp, for example because it was overwritten or cleared.
+ */
+bool CFrameStamps::Take(int64_t timestamp, int64_t* pStampTime)
+{
+    for (int i = 0; i < STAMP_COUNT; i++)
+    {
+        Slot *pSlot = &m_Slots[i];
+        int state = g_atomic_int_get(&pSlot->state);
+
+        if ((state & SLOT_STATE_MASK) != SLOT_VALID || pSlot->timestamp != timestamp)
+            continue;
+
+        int64_t time = pSlot->time;
+
+        // Fails if the producer started rewriting the slot after the state was
+        // read, in which case the values read above may be torn.
+        if (g_atomic_int_compare_and_exchange(&pSlot->state, state, state & ~SLOT_STATE_MASK))
+        {
+            *pStampTime = time;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * CFrameStamps::Clear()
+ *
+ * Forgets all stamps, used when the pipeline flushes.
+ */
+void CFrameStamps::Clear()
+{
+    for (int i = 0; i < STAMP_COUNT; i++)
+    {
+        Slot *pSlot = &m_Slots[i];
+        int state = g_atomic_int_get(&pSlot->state);
+
+        if ((state & SLOT_STATE_MASK) == SLOT_VALID)
+            g_atomic_int_compare_and_exchange(&pSlot->state, state, state & ~SLOT_STATE_MASK);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _PIPELINE_METRICS_H_
+#define _PIPELINE_METRICS_H_
+
+#include <stdint.h>
+
+/**
+ * Always-on playback statistics of a single pipeline. Counters and histogram
+ * buckets are updated with atomic operations so streaming threads never block,
+ * and a snapshot can be taken from any thread at any time.
+ *
+ * Histograms use fixed power of two buckets: bucket 0 holds samples below
+ * HISTOGRAM_BASE_MICROS, bucket i holds samples below HISTOGRAM_BASE_MICROS << i
+ * and the last bucket holds everything above.
+ *
+ * The object is reference counted since video frames handed to Java may outlive
+ * the pipeline that produced them.
+ */
+class CPipelineMetrics
+{
+public:
+    enum Counter
+    {
+        FRAMES_DECODED = 0,
+        FRAMES_RENDERED,
+        FRAMES_DROPPED,     // Frames the video sink reported dropped in its QoS statistics
+        FRAMES_LATE,        // Frames rendered more than one frame duration late
+        QUEUE_UNDERRUNS,
+        AV_DRIFT_MICROS,    // Lateness of the last video frame against the pipeline clock
+        COUNTER_COUNT
+    };
+
+    enum Histogram
+    {
+        DECODE_LATENCY = 0,
+        COLOR_CONVERSION,
+        SINK_QUEUE,
+        PRESENTATION_DELAY,
+        HISTOGRAM_COUNT
+    };
+
+    enum
+    {
+        BUCKET_COUNT = 16,
+        HISTOGRAM_BASE_MICROS = 128,
+        // Snapshot layout: counters, then for every histogram its buckets,
+        // the number of samples and the largest sample.
+        HISTOGRAM_SNAPSHOT_SIZE = BUCKET_COUNT + 2,
+        SNAPSHOT_SIZE = COUNTER_COUNT + HISTOGRAM_COUNT * HISTOGRAM_SNAPSHOT_SIZE
+    };
+
+    static CPipelineMetrics* Create();
+    static CPipelineMetrics* AddRef(CPipelineMetrics* pMetrics);
+    static void              Release(CPipelineMetrics* pMetrics);
+
+    static int64_t           Now();  // Monotonic time in microseconds
+
+    void    Increment(Counter counter);
+    void    Add(Counter counter, int64_t delta);
+    void    Set(Counter counter, int64_t value);
+    void    Record(Histogram histogram, int64_t micros);
+
+    void    Snapshot(int64_t* pValues) const;
+
+private:
+    CPipelineMetrics();
+    ~CPipelineMetrics() {}
+
+private:
+    volatile int m_RefCount;
+    volatile int m_Counters[COUNTER_COUNT];
+    volatile int m_Buckets[HISTOGRAM_COUNT][BUCKET_COUNT];
+    volatile int m_Samples[HISTOGRAM_COUNT];
+    volatile int m_Max[HISTOGRAM_COUNT];
+};
+
+/**
+ * Remembers when buffers with a given timestamp passed one point of the
+ * pipeline, so the time they take to reach a later point can be measured even
+ * if they arrive there out of order.
+ *
+ * This is a ring of STAMP_COUNT slots with a single producer, the streaming
+ * thread calling Stamp(). Take() and Clear() may run on any thread. No locks
+ * are taken: each slot carries a state word whose low bits say whether the
+ * slot is empty, being written or holds a stamp, and whose upper bits are a
+ * generation bumped on every write. Take() claims a stamp with a compare and
+ * exchange on that word, which fails if the producer reused the slot while it
+ * was being read.
+ */
+class CFrameStamps
+{
+public:
+    CFrameStamps();
+
+    void    Stamp(int64_t timestamp, int64_t now);
+    bool    Take(int64_t timestamp, int64_t* pStampTime);
+    void    Clear();
+
+private:
+    enum
+    {
+        STAMP_COUNT = 32,
+        SLOT_EMPTY = 0,
+        SLOT_WRITING = 1,
+        SLOT_VALID = 2,
+        SLOT_STATE_MASK = 3,
+        SLOT_GENERATION = 4
+    };
+
+    struct Slot
+    {
+        volatile int     state;
+        volatile int64_t timestamp;
+        volatile int64_t time;
+    };
+
+    Slot        m_Slots[STAMP_COUNT];
+    int         m_Next;     // Only used by the producer
+};
+
+#endif // _PIPELINE_METRICS_H_
@@ -38,6 +38,7 @@ CVideoFrame::CVideoFrame()
     m_bHasAlpha(false),
     m_dTime(0.0),
     m_FrameDirty(false),
+    m_pMetrics(NULL),
     m_iPlaneCount(1)
 {
     m_piPlaneStrides[0] = m_piPlaneStrides[1] = m_piPlaneStrides[2] = m_piPlaneStrides[3] = 0;
@@ -47,6 +48,14 @@ CVideoFrame::CVideoFrame()
 
 CVideoFrame::~CVideoFrame()
 {
+    CPipelineMetrics::Release(m_pMetrics);
+}
+
+void CVideoFrame::SetMetrics(CPipelineMetrics* pMetrics)
+{
+    CPipelineMetrics::AddRef(pMetrics);
+    CPipelineMetrics::Release(m_pMetrics);
+    m_pMetrics = pMetrics;
 }
 
 int CVideoFrame::GetWidth()
@@ -27,6 +27,7 @@
 #define _VIDEO_FRAME_H_
 
 #include <stdlib.h>
+#include "PipelineMetrics.h"
 
 /**
  * class CVideoFrame
@@ -74,6 +75,10 @@ public:
     bool                GetFrameDirty() { return m_FrameDirty; }
     void                SetFrameDirty(bool dirty) { m_FrameDirty = dirty; }
 
+    // Metrics of the pipeline that produced the frame, may be NULL
+    CPipelineMetrics*   GetMetrics() { return m_pMetrics; }
+    void                SetMetrics(CPipelineMetrics* pMetrics);
+
 protected:
     int                 m_iWidth;
     int                 m_iHeight;
@@ -83,6 +88,7 @@ protected:
     bool                m_bHasAlpha;
     double              m_dTime;
     bool                m_FrameDirty;
+    CPipelineMetrics*   m_pMetrics;
 
     // frame data buffers
     int                 m_iPlaneCount;
@@ -25,8 +25,18 @@
 
 #include "JavaBandsHolder.h"
 #include "JniUtils.h"
+#include <string.h>
+
+#define HEADER_SIZE         8
+#define SLOT_HEADER_SIZE    (2 * sizeof(jdouble))
+#define SLOT_SIZE(bands)    (SLOT_HEADER_SIZE + 2 * (size_t)(bands) * sizeof(jfloat))
 
 CJavaBandsHolder::CJavaBandsHolder()
+    : m_jvm(NULL),
+      m_Bands(0),
+      m_Buffer(NULL),
+      m_pSequence(NULL),
+      m_pSlots(NULL)
 {
 }
 
@@ -36,21 +46,14 @@ CJavaBandsHolder::~CJavaBandsHolder()
         CJavaEnvironment jenv(m_jvm);
         JNIEnv *pEnv = jenv.getEnvironment();
 
-        if (pEnv) {
-            if (m_Magnitudes) {
-                pEnv->DeleteGlobalRef(m_Magnitudes);
-                m_Magnitudes = NULL;
-            }
-
-            if (m_Phases) {
-                pEnv->DeleteGlobalRef(m_Phases);
-                m_Phases = NULL;
-            }
+        if (pEnv && m_Buffer) {
+            pEnv->DeleteGlobalRef(m_Buffer);
+            m_Buffer = NULL;
         }
     }
 }
 
-bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases)
+bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jobject buffer)
 {
     env->GetJavaVM(&m_jvm);
     if (env->ExceptionCheck()) {
@@ -59,9 +62,23 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
         return false;
     }
 
+    jbyte *pAddress = (jbyte*)env->GetDirectBufferAddress(buffer);
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (pAddress == NULL || bands <= 0 ||
+        capacity < (jlong)(HEADER_SIZE + 2 * SLOT_SIZE(bands))) {
+        m_jvm = NULL;
+        return false;
+    }
+
+    m_Buffer = env->NewGlobalRef(buffer);
+    if (m_Buffer == NULL) {
+        m_jvm = NULL;
+        return false;
+    }
+
     m_Bands = bands;
-    m_Magnitudes = (jfloatArray)env->NewGlobalRef(magnitudes);
-    m_Phases = (jfloatArray)env->NewGlobalRef(phases);
+    m_pSequence = (volatile int*)pAddress;
+    m_pSlots = pAddress + HEADER_SIZE;
 
     InitRef(this);
 
@@ -70,22 +87,27 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
 
 void CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
-    if (m_Bands != size || m_jvm == NULL)
+    // Platforms calling this send the timestamp with an AudioSpectrumEvent.
+    PublishBands(0.0, 0.0, size, magnitudes, phases);
+}
+
+void CJavaBandsHolder::PublishBands(double timestamp, double duration, int size,
+                                    const float* magnitudes, const float* phases)
+{
+    if (m_Bands != size || m_pSlots == NULL)
         return;
 
-    CJavaEnvironment jenv(m_jvm);
-    JNIEnv *pEnv = jenv.getEnvironment();
-    if (pEnv) {
-        // use local references due to threading issues
-        jfloatArray localMagnitudes = (jfloatArray)pEnv->NewLocalRef(m_Magnitudes);
-        jfloatArray localPhases = (jfloatArray)pEnv->NewLocalRef(m_Phases);
+    // Only the streaming thread writes, so a plain read of the sequence is
+    // enough to pick the slot Java is not reading.
+    int sequence = *m_pSequence + 1;
+    jbyte *pSlot = m_pSlots + (size_t)(sequence & 1) * SLOT_SIZE(size);
+    jdouble *pTimes = (jdouble*)pSlot;
+    float *pBands = (float*)(pSlot + SLOT_HEADER_SIZE);
 
-        if (localMagnitudes && localPhases) {
-            pEnv->SetFloatArrayRegion(localMagnitudes, 0, size, magnitudes);
-            pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
-        }
+    pTimes[0] = timestamp;
+    pTimes[1] = duration;
+    memcpy(pBands, magnitudes, size * sizeof(float));
+    memcpy(pBands + size, phases, size * sizeof(float));
 
-        pEnv->DeleteLocalRef(localMagnitudes);
-        pEnv->DeleteLocalRef(localPhases);
-    }
+    PublishSequence(m_pSequence, sequence);
 }
@@ -29,6 +29,12 @@
 #include <jni.h>
 #include <PipelineManagement/AudioSpectrum.h>
 
+// Spectrum results are written straight into a direct ByteBuffer owned by
+// NativeAudioSpectrum. The buffer starts with a 32-bit sequence number padded
+// to 8 bytes, followed by two slots, each holding the timestamp and duration
+// as doubles and then the magnitudes and phases. Slot (sequence & 1) holds the
+// most recently published bands; the other slot is written by the next update
+// and published by incrementing the sequence.
 class CJavaBandsHolder : public CBandsHolder
 {
 public:
@@ -36,14 +42,17 @@ public:
     ~CJavaBandsHolder();
 
 public:
-    bool Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases);
+    bool Init(JNIEnv* env, int bands, jobject buffer);
     void UpdateBands(int size, const float* magnitudes, const float* phases);
+    void PublishBands(double timestamp, double duration, int size,
+                      const float* magnitudes, const float* phases);
 
 private:
     JavaVM      *m_jvm;
     int         m_Bands;
-    jfloatArray m_Magnitudes;
-    jfloatArray m_Phases;
+    jobject     m_Buffer;
+    volatile int *m_pSequence;
+    jbyte       *m_pSlots;
 };
 
 #endif // _JAVA_SPECTRUM_UPDATER_H_
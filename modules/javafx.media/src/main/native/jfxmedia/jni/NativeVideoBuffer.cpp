@@ -225,7 +225,13 @@ JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_native
 {
     CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
     if (frame) {
-        return ptr_to_jlong(frame->ConvertToFormat((CVideoFrame::FrameType)newFormat));
+        CPipelineMetrics *pMetrics = frame->GetMetrics();
+        int64_t start = (pMetrics != NULL) ? CPipelineMetrics::Now() : 0;
+        CVideoFrame *converted = frame->ConvertToFormat((CVideoFrame::FrameType)newFormat);
+        if (pMetrics != NULL && converted != NULL) {
+            pMetrics->Record(CPipelineMetrics::COLOR_CONVERSION, CPipelineMetrics::Now() - start);
+        }
+        return ptr_to_jlong(converted);
     }
     return 0;
 }
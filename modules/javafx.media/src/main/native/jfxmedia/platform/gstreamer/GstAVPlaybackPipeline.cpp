@@ -54,6 +54,8 @@ CGstAVPlaybackPipeline::CGstAVPlaybackPipeline(const GstElementContainer& elemen
 {
     LOGGER_LOGMSG(LOGGER_DEBUG, "CGstAVPlaybackPipeline::CGstAVPlaybackPipeline()");
     m_videoDecoderSrcProbeHID = 0L;
+    m_videoDecoderSinkMetricsHID = 0L;
+    m_videoDecoderSrcMetricsHID = 0L;
     m_EncodedVideoFrameRate = 24.0F;
     m_SendFrameSizeEvent = TRUE;
     m_FrameWidth = 0;
@@ -110,8 +112,17 @@ uint32_t CGstAVPlaybackPipeline::PostBuildInit()
         if (NULL == pPad)
             return ERROR_GSTREAMER_VIDEO_DECODER_SINK_PAD;
         m_videoDecoderSrcProbeHID = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, (GstPadProbeCallback)VideoDecoderSrcProbe, this, NULL);
+        m_videoDecoderSrcMetricsHID = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, (GstPadProbeCallback)VideoDecoderSrcMetricsProbe, this, NULL);
         gst_object_unref(pPad);
 
+        // Buffers entering the decoder are timestamped to measure decode latency
+        pPad = gst_element_get_static_pad(m_Elements[VIDEO_DECODER], "sink");
+        if (NULL != pPad)
+        {
+            m_videoDecoderSinkMetricsHID = gst_pad_add_probe(pPad, (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_FLUSH), (GstPadProbeCallback)VideoDecoderSinkMetricsProbe, this, NULL);
+            gst_object_unref(pPad);
+        }
+
         m_bVideoInitDone = true;
     }
 
@@ -136,6 +147,22 @@ void CGstAVPlaybackPipeline::Dispose()
         g_signal_handlers_disconnect_by_func(m_Elements[VIDEO_SINK], (void*)G_CALLBACK(OnAppSinkHaveFrame), this);
         g_signal_handlers_disconnect_by_func(m_Elements[VIDEO_SINK], (void*)G_CALLBACK(OnAppSinkPreroll), this);
 #endif
+
+        GstPad *pPad = NULL;
+        if (m_videoDecoderSinkMetricsHID != 0L &&
+            NULL != (pPad = gst_element_get_static_pad(m_Elements[VIDEO_DECODER], "sink")))
+        {
+            gst_pad_remove_probe(pPad, m_videoDecoderSinkMetricsHID);
+            gst_object_unref(pPad);
+            m_videoDecoderSinkMetricsHID = 0L;
+        }
+        if (m_videoDecoderSrcMetricsHID != 0L &&
+            NULL != (pPad = gst_element_get_static_pad(m_Elements[VIDEO_DECODER], "src")))
+        {
+            gst_pad_remove_probe(pPad, m_videoDecoderSrcMetricsHID);
+            gst_object_unref(pPad);
+            m_videoDecoderSrcMetricsHID = 0L;
+        }
     }
 
     g_signal_handlers_disconnect_by_func(m_Elements[AUDIO_QUEUE], (void*)G_CALLBACK(queue_overrun), this);
@@ -272,6 +299,8 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
     if (pPipeline->m_SendFrameSizeEvent || GST_BUFFER_IS_DISCONT(pBuffer))
         OnAppSinkVideoFrameDiscont(pPipeline, pSample);
 
+    UpdatePresentationMetrics(pPipeline, pElem, pSample);
+
     //***** Create a VideoFrame object
     CGstVideoFrame* pVideoFrame = new CGstVideoFrame();
     if (!pVideoFrame->Init(pSample))
@@ -280,6 +309,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
         delete pVideoFrame;
         return GST_FLOW_OK;
     }
+    pVideoFrame->SetMetrics(pPipeline->m_pMetrics);
 
     if (pVideoFrame->IsValid() && pPipeline->m_pEventDispatcher)
     {
@@ -345,6 +375,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkPreroll(GstElement* pElem, CGstAV
             delete pVideoFrame;
             return GST_FLOW_OK;
         }
+        pVideoFrame->SetMetrics(pPipeline->m_pMetrics);
         if (pVideoFrame->IsValid()) {
             if (!pPipeline->m_pEventDispatcher->SendNewFrameEvent(pVideoFrame))
             {
@@ -673,6 +704,9 @@ void CGstAVPlaybackPipeline::queue_overrun(GstElement *element, CGstAVPlaybackPi
 
 void CGstAVPlaybackPipeline::queue_underrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline)
 {
+    if (pPipeline->m_pMetrics != NULL)
+        pPipeline->m_pMetrics->Increment(CPipelineMetrics::QUEUE_UNDERRUNS);
+
     if (pPipeline->m_pOptions->GetHLSModeEnabled())
     {
         if (pPipeline->m_Elements[AUDIO_QUEUE] == element)
@@ -725,6 +759,106 @@ void CGstAVPlaybackPipeline::queue_underrun(GstElement *element, CGstAVPlaybackP
     }
 }
 
+/**
+ * CGstAVPlaybackPipeline::UpdatePresentationMetrics()
+ *
+ * Records how long a frame spent between the decoder and the sink and how late
+ * it is presented against the pipeline clock, which follows the audio.
+ */
+void CGstAVPlaybackPipeline::UpdatePresentationMetrics(CGstAVPlaybackPipeline* pPipeline, GstElement* pSink, GstSample* pSample)
+{
+    CPipelineMetrics *pMetrics = pPipeline->m_pMetrics;
+    GstBuffer *pBuffer = gst_sample_get_buffer(pSample);
+    GstClockTime pts = GST_BUFFER_PTS(pBuffer);
+    int64_t stampTime = 0;
+
+    if (NULL == pMetrics)
+        return;
+
+    pMetrics->Increment(CPipelineMetrics::FRAMES_RENDERED);
+
+    if (!GST_CLOCK_TIME_IS_VALID(pts))
+        return;
+
+    if (pPipeline->m_SinkStamps.Take((int64_t)pts, &stampTime))
+        pMetrics->Record(CPipelineMetrics::SINK_QUEUE, CPipelineMetrics::Now() - stampTime);
+
+    GstClock *pClock = gst_element_get_clock(pSink);
+    GstSegment *pSegment = gst_sample_get_segment(pSample);
+    if (NULL != pClock && NULL != pSegment)
+    {
+        GstClockTime runningTime = gst_segment_to_running_time(pSegment, GST_FORMAT_TIME, pts);
+        if (GST_CLOCK_TIME_IS_VALID(runningTime))
+        {
+            GstClockTimeDiff lateness = GST_CLOCK_DIFF(runningTime,
+                gst_clock_get_time(pClock) - gst_element_get_base_time(pSink));
+
+            pMetrics->Record(CPipelineMetrics::PRESENTATION_DELAY, lateness / GST_USECOND);
+            pMetrics->Set(CPipelineMetrics::AV_DRIFT_MICROS, lateness / GST_USECOND);
+            if (GST_BUFFER_DURATION_IS_VALID(pBuffer) && lateness > (GstClockTimeDiff)GST_BUFFER_DURATION(pBuffer))
+                pMetrics->Increment(CPipelineMetrics::FRAMES_LATE);
+        }
+    }
+
+    if (NULL != pClock)
+        gst_object_unref(pClock);
+}
+
+/**
+ * CGstAVPlaybackPipeline::VideoDecoderSinkMetricsProbe()
+ *
+ * Remembers when each buffer entered the video decoder. Stamps are forgotten
+ * on flush, since frames queued before a seek will never be rendered.
+ */
+GstPadProbeReturn CGstAVPlaybackPipeline::VideoDecoderSinkMetricsProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline)
+{
+    if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_FLUSH)
+    {
+        GstEvent *pEvent = GST_PAD_PROBE_INFO_EVENT(pInfo);
+        if (NULL != pEvent && GST_EVENT_FLUSH_STOP == GST_EVENT_TYPE(pEvent))
+        {
+            pPipeline->m_DecodeStamps.Clear();
+            pPipeline->m_SinkStamps.Clear();
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    GstBuffer *pBuffer = GST_PAD_PROBE_INFO_BUFFER(pInfo);
+    if (NULL != pBuffer && GST_BUFFER_PTS_IS_VALID(pBuffer))
+        pPipeline->m_DecodeStamps.Stamp((int64_t)GST_BUFFER_PTS(pBuffer), CPipelineMetrics::Now());
+
+    return GST_PAD_PROBE_OK;
+}
+
+/**
+ * CGstAVPlaybackPipeline::VideoDecoderSrcMetricsProbe()
+ *
+ * Counts decoded frames and records the decode latency of frames whose input
+ * buffer was seen by VideoDecoderSinkMetricsProbe().
+ */
+GstPadProbeReturn CGstAVPlaybackPipeline::VideoDecoderSrcMetricsProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline)
+{
+    GstBuffer *pBuffer = GST_PAD_PROBE_INFO_BUFFER(pInfo);
+    CPipelineMetrics *pMetrics = pPipeline->m_pMetrics;
+
+    if (NULL == pBuffer || NULL == pMetrics)
+        return GST_PAD_PROBE_OK;
+
+    pMetrics->Increment(CPipelineMetrics::FRAMES_DECODED);
+
+    if (GST_BUFFER_PTS_IS_VALID(pBuffer))
+    {
+        int64_t now = CPipelineMetrics::Now();
+        int64_t stampTime = 0;
+
+        if (pPipeline->m_DecodeStamps.Take((int64_t)GST_BUFFER_PTS(pBuffer), &stampTime))
+            pMetrics->Record(CPipelineMetrics::DECODE_LATENCY, now - stampTime);
+        pPipeline->m_SinkStamps.Stamp((int64_t)GST_BUFFER_PTS(pBuffer), now);
+    }
+
+    return GST_PAD_PROBE_OK;
+}
+
 /**
  * CGstAVPlaybackPipeline::VideoDecoderSrcProbe()
  *
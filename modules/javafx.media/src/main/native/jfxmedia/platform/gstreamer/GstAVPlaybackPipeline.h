@@ -68,6 +68,9 @@ private:
     static GstFlowReturn     OnAppSinkHaveFrame(GstElement* pElem, CGstAVPlaybackPipeline* pPipeline);
     static void     OnAppSinkVideoFrameDiscont(CGstAVPlaybackPipeline* pPipeline, GstSample *pSample);
     static GstPadProbeReturn VideoDecoderSrcProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline);
+    static GstPadProbeReturn VideoDecoderSinkMetricsProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline);
+    static GstPadProbeReturn VideoDecoderSrcMetricsProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline);
+    static void     UpdatePresentationMetrics(CGstAVPlaybackPipeline* pPipeline, GstElement* pSink, GstSample* pSample);
 
     inline float    GetEncodedVideoFrameRate()
     {
@@ -81,6 +84,12 @@ private:
     gulong                  m_videoDecoderSrcProbeHID;
     gfloat                  m_EncodedVideoFrameRate;
     int                     m_videoCodecErrorCode;
+
+    // Metrics
+    gulong                  m_videoDecoderSinkMetricsHID;
+    gulong                  m_videoDecoderSrcMetricsHID;
+    CFrameStamps            m_DecodeStamps;     // Buffers entering the decoder
+    CFrameStamps            m_SinkStamps;       // Frames leaving the decoder
 };
 
 #endif  //_GST_AV_PLAYBACK_PIPELINE_H_
@@ -60,6 +60,7 @@ CGstAudioPlaybackPipeline::CGstAudioPlaybackPipeline(const GstElementContainer&
     m_fRate = 1.0F;
     m_audioSourcePadProbeHID = 0L;
     m_ulLastStreamTime = (GstClockTime)0UL;
+    m_ullLastQosDropped = 0;
     m_pBusSource = NULL;
     m_bIgnoreError = FALSE;
 
@@ -1417,51 +1418,29 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
             break;
 #endif  //ENABLE_PROGRESS_BUFFER
 
-        case GST_MESSAGE_ELEMENT:
+        // The spectrum element reports straight into the shared band buffer
+        // through CGstAudioSpectrum, so it posts no element messages here.
+
+        case GST_MESSAGE_QOS:
         {
-            const GstStructure *pStr = gst_message_get_structure (msg);
-            if (gst_structure_has_name(pStr, "spectrum"))
+            // Only the video sink drops frames; the stats it posts are running
+            // totals that restart after a flush.
+            GstElement* pVideoSink = pPipeline->m_Elements[VIDEO_SINK];
+            if (NULL != pVideoSink && NULL != pPipeline->m_pMetrics &&
+                GST_MESSAGE_SRC(msg) == GST_OBJECT(pVideoSink))
             {
-                GstClockTime timestamp, duration;
-
-                if (!gst_structure_get_clock_time (pStr, "timestamp", &timestamp))
-                    timestamp = GST_CLOCK_TIME_NONE;
-
-                if (!gst_structure_get_clock_time (pStr, "duration", &duration))
-                    duration = GST_CLOCK_TIME_NONE;
-
-                size_t bandsNum = pPipeline->GetAudioSpectrum()->GetBands();
-
-                if (bandsNum > 0)
+                GstFormat format = GST_FORMAT_UNDEFINED;
+                guint64 processed = 0;
+                guint64 dropped = 0;
+                gst_message_parse_qos_stats(msg, &format, &processed, &dropped);
+                if (GST_FORMAT_BUFFERS == format && (guint64)-1 != dropped)
                 {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
-                    const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-                    const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-                    for (int i=0; i < bandsNum; i++)
-                    {
-                        magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
-                    }
-                    pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
-
-                    delete [] magnitudes;
-                    delete [] phases;
+                    guint64 last = pPipeline->m_ullLastQosDropped;
+                    pPipeline->m_pMetrics->Add(CPipelineMetrics::FRAMES_DROPPED,
+                                               (int64_t)(dropped >= last ? dropped - last : dropped));
+                    pPipeline->m_ullLastQosDropped = dropped;
                 }
-
-                if (!pPipeline->m_pEventDispatcher->SendAudioSpectrumEvent(GST_TIME_AS_SECONDS((double)timestamp),
-                    GST_TIME_AS_SECONDS((double)duration), false)) // Always false, since GStreamer does not need it,
-                                                                   // but if it will be required such case needs to be
-                                                                   // tested.
-                {
-                    if(!pPipeline->m_pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_AUDIO_SPECTRUM_EVENT))
-                    {
-                        LOGGER_LOGMSG(LOGGER_ERROR, "Cannot send media error event.\n");
-                    }
-                }
-          }
-
+            }
         }
             break;
 
@@ -141,6 +141,7 @@ protected:
     float               m_fRate;
     volatile bool       m_bSeekInvoked;
     GstClockTime        m_ulLastStreamTime;
+    guint64             m_ullLastQosDropped; // Dropped count of the last video sink QoS message
     CGstAudioEqualizer* m_pAudioEqualizer;
     CGstAudioSpectrum*  m_pAudioSpectrum;
     int                 m_audioCodecErrorCode;
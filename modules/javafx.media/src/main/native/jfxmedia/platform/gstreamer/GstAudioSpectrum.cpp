@@ -51,6 +51,13 @@ void CBandsHolder::ReleaseRef(CBandsHolder* ref)
         delete ref;
 }
 
+// g_atomic_int_set() is a full barrier, so every band value stored before
+// this call is visible to a reader that observes the new sequence number.
+void CBandsHolder::PublishSequence(volatile int* sequence, int value)
+{
+    g_atomic_int_set(sequence, value);
+}
+
 /************************************************************************
  *
  *************************************************************************/
@@ -58,15 +65,21 @@ CGstAudioSpectrum::CGstAudioSpectrum(GstElement* pSpectrum, bool enabled)
 {
     m_pSpectrum = GST_ELEMENT(gst_object_ref(pSpectrum));
 
-    // Do send magnitude and phase infromation, off by default
+    g_atomic_pointer_set(&m_pHolder, NULL);
+
+    // Do send magnitude and phase infromation, off by default. Results go
+    // straight into the bands holder instead of a bus message.
     g_object_set(m_pSpectrum, "post-messages", enabled,
                               "message-magnitude", TRUE,
-                              "message-phase", TRUE, NULL);
-    g_atomic_pointer_set(&m_pHolder, NULL);
+                              "message-phase", TRUE,
+                              "bands-callback-data", this,
+                              "bands-callback", (gpointer)OnBands, NULL);
 }
 
 CGstAudioSpectrum::~CGstAudioSpectrum()
 {
+    // Returns only once the streaming thread is out of OnBands().
+    g_object_set(m_pSpectrum, "bands-callback", NULL, NULL);
     CBandsHolder::ReleaseRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
     gst_object_unref(m_pSpectrum);
 }
@@ -102,7 +115,23 @@ void CGstAudioSpectrum::SetBands(int bands, CBandsHolder* holder)
 void CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
     CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
-    holder->UpdateBands(size, magnitudes, phases);
+    if (holder != NULL)
+        holder->UpdateBands(size, magnitudes, phases);
+    CBandsHolder::ReleaseRef(holder);
+}
+
+// Called on the streaming thread with the spectrum lock held.
+void CGstAudioSpectrum::OnBands(GstSpectrum* spectrum, GstClockTime timestamp,
+                                GstClockTime duration, guint bands,
+                                const gfloat* magnitudes, const gfloat* phases,
+                                gpointer user_data)
+{
+    CGstAudioSpectrum *pSelf = (CGstAudioSpectrum*)user_data;
+    CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&pSelf->m_pHolder));
+    if (holder != NULL)
+        holder->PublishBands(GST_TIME_AS_SECONDS((double)timestamp),
+                             GST_TIME_AS_SECONDS((double)duration),
+                             (int)bands, magnitudes, phases);
     CBandsHolder::ReleaseRef(holder);
 }
 
@@ -28,6 +28,7 @@
 
 #include <PipelineManagement/AudioSpectrum.h>
 #include <gst/gst.h>
+#include <gstspectrum.h>
 
 class CGstAudioSpectrum : public CAudioSpectrum
 {
@@ -48,6 +49,12 @@ public:
     virtual int       GetThreshold();
     virtual void      SetThreshold(int threshold);
 
+private:
+    static void       OnBands(GstSpectrum* spectrum, GstClockTime timestamp,
+                              GstClockTime duration, guint bands,
+                              const gfloat* magnitudes, const gfloat* phases,
+                              gpointer user_data);
+
 private:
     GstElement*            m_pSpectrum;
     volatile CBandsHolder* m_pHolder;
@@ -521,6 +521,39 @@ JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMed
     return iRet;
 }
 
+/**
+ * gstGetMetrics()
+ *
+ * Copies a snapshot of the pipeline metrics into the supplied array.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstGetMetrics
+(JNIEnv *env, jobject obj, jlong ref_media, jlongArray jrglValues)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    CPipelineMetrics* pMetrics = pPipeline->GetMetrics();
+    if (NULL == pMetrics)
+        return ERROR_MEMORY_ALLOCATION;
+
+    if (NULL == jrglValues || env->GetArrayLength(jrglValues) < CPipelineMetrics::SNAPSHOT_SIZE)
+        return ERROR_FUNCTION_PARAM;
+
+    int64_t values[CPipelineMetrics::SNAPSHOT_SIZE];
+    jlong jlValues[CPipelineMetrics::SNAPSHOT_SIZE];
+    pMetrics->Snapshot(values);
+    for (int i = 0; i < CPipelineMetrics::SNAPSHOT_SIZE; i++)
+        jlValues[i] = (jlong)values[i];
+    env->SetLongArrayRegion(jrglValues, 0, CPipelineMetrics::SNAPSHOT_SIZE, jlValues);
+
+    return ERROR_NONE;
+}
+
 #ifdef __cplusplus
 }
 #endif
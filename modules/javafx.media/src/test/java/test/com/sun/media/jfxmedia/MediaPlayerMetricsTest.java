@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.media.jfxmedia;
+
+import com.sun.media.jfxmedia.MediaPlayerMetrics;
+import com.sun.media.jfxmedia.MediaPlayerMetrics.Histogram;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+
+import org.junit.Test;
+
+public class MediaPlayerMetricsTest {
+
+    // Layout written by CPipelineMetrics::Snapshot()
+    private static final int COUNTER_COUNT = 6;
+    private static final int HISTOGRAM_SNAPSHOT_SIZE = MediaPlayerMetrics.BUCKET_COUNT + 2;
+
+    private static long[] snapshot() {
+        long[] values = new long[MediaPlayerMetrics.SNAPSHOT_SIZE];
+        for (int i = 0; i < COUNTER_COUNT; i++) {
+            values[i] = i + 1;
+        }
+        return values;
+    }
+
+    private static void setHistogram(long[] values, int histogram, long max, long... buckets) {
+        int offset = COUNTER_COUNT + histogram * HISTOGRAM_SNAPSHOT_SIZE;
+        long count = 0;
+        for (int i = 0; i < buckets.length; i++) {
+            values[offset + i] = buckets[i];
+            count += buckets[i];
+        }
+        values[offset + MediaPlayerMetrics.BUCKET_COUNT] = count;
+        values[offset + MediaPlayerMetrics.BUCKET_COUNT + 1] = max;
+    }
+
+    @Test
+    public void testSnapshotSize() {
+        assertEquals(COUNTER_COUNT + 4 * HISTOGRAM_SNAPSHOT_SIZE, MediaPlayerMetrics.SNAPSHOT_SIZE);
+    }
+
+    @Test
+    public void testCounters() {
+        MediaPlayerMetrics metrics = new MediaPlayerMetrics(snapshot());
+        assertEquals(1, metrics.getFramesDecoded());
+        assertEquals(2, metrics.getFramesRendered());
+        assertEquals(3, metrics.getFramesDropped());
+        assertEquals(4, metrics.getFramesLate());
+        assertEquals(5, metrics.getQueueUnderruns());
+        assertEquals(6, metrics.getAVDriftMicros());
+    }
+
+    @Test
+    public void testHistogramOrder() {
+        long[] values = snapshot();
+        setHistogram(values, 0, 10, 1);
+        setHistogram(values, 1, 20, 2);
+        setHistogram(values, 2, 30, 3);
+        setHistogram(values, 3, 40, 4);
+        MediaPlayerMetrics metrics = new MediaPlayerMetrics(values);
+
+        assertEquals(1, metrics.getDecodeLatency().getCount());
+        assertEquals(10, metrics.getDecodeLatency().getMaxMicros());
+        assertEquals(2, metrics.getColorConversion().getCount());
+        assertEquals(3, metrics.getSinkQueue().getCount());
+        assertEquals(40, metrics.getPresentationDelay().getMaxMicros());
+        assertEquals(4, metrics.getPresentationDelay().getBucket(0));
+    }
+
+    @Test
+    public void testBucketLimits() {
+        assertEquals(128, Histogram.getBucketLimitMicros(0));
+        assertEquals(256, Histogram.getBucketLimitMicros(1));
+        assertEquals(128L << 14, Histogram.getBucketLimitMicros(MediaPlayerMetrics.BUCKET_COUNT - 2));
+        assertEquals(Long.MAX_VALUE, Histogram.getBucketLimitMicros(MediaPlayerMetrics.BUCKET_COUNT - 1));
+    }
+
+    @Test
+    public void testPercentiles() {
+        long[] values = snapshot();
+        // 50 samples below 128us, 40 below 256us, 9 below 512us and one above
+        long[] buckets = new long[MediaPlayerMetrics.BUCKET_COUNT];
+        buckets[0] = 50;
+        buckets[1] = 40;
+        buckets[2] = 9;
+        buckets[MediaPlayerMetrics.BUCKET_COUNT - 1] = 1;
+        setHistogram(values, 0, 5_000_000, buckets);
+        Histogram histogram = new MediaPlayerMetrics(values).getDecodeLatency();
+
+        assertEquals(100, histogram.getCount());
+        assertEquals(128, histogram.getPercentileMicros(50));
+        assertEquals(256, histogram.getPercentileMicros(90));
+        assertEquals(512, histogram.getPercentileMicros(99));
+        assertEquals(5_000_000, histogram.getPercentileMicros(100));
+    }
+
+    @Test
+    public void testPercentileBoundedByMax() {
+        long[] values = snapshot();
+        setHistogram(values, 0, 300, 0, 0, 10);
+        Histogram histogram = new MediaPlayerMetrics(values).getDecodeLatency();
+
+        assertEquals(300, histogram.getPercentileMicros(50));
+    }
+
+    @Test
+    public void testEmptyHistogram() {
+        Histogram histogram = new MediaPlayerMetrics(snapshot()).getSinkQueue();
+        assertNotNull(histogram);
+        assertEquals(0, histogram.getCount());
+        assertEquals(0, histogram.getPercentileMicros(99));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testNullSnapshot() {
+        new MediaPlayerMetrics(null);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testShortSnapshot() {
+        new MediaPlayerMetrics(new long[MediaPlayerMetrics.SNAPSHOT_SIZE - 1]);
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Checks CPipelineMetrics and the lock-free CFrameStamps ring: histogram
+ * buckets, the snapshot layout shared with MediaPlayerMetrics, out of order
+ * and overwritten stamps, and a producer racing a consumer. Built and run by
+ * "make check" in the jfxmedia project.
+ */
+
+#include <PipelineManagement/PipelineMetrics.h>
+
+#include <glib.h>
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static void check_histogram()
+{
+    CPipelineMetrics *pMetrics = CPipelineMetrics::Create();
+    int64_t values[CPipelineMetrics::SNAPSHOT_SIZE];
+    const int base = CPipelineMetrics::COUNTER_COUNT +
+                     CPipelineMetrics::SINK_QUEUE * CPipelineMetrics::HISTOGRAM_SNAPSHOT_SIZE;
+
+    pMetrics->Record(CPipelineMetrics::SINK_QUEUE, -5);     // Counted as zero
+    pMetrics->Record(CPipelineMetrics::SINK_QUEUE, 127);
+    pMetrics->Record(CPipelineMetrics::SINK_QUEUE, 128);
+    pMetrics->Record(CPipelineMetrics::SINK_QUEUE, 300);
+    pMetrics->Record(CPipelineMetrics::SINK_QUEUE, G_MAXINT64);
+    pMetrics->Snapshot(values);
+
+    CHECK(values[base + 0] == 2);
+    CHECK(values[base + 1] == 1);
+    CHECK(values[base + 2] == 1);
+    CHECK(values[base + CPipelineMetrics::BUCKET_COUNT - 1] == 1);
+    CHECK(values[base + CPipelineMetrics::BUCKET_COUNT] == 5);
+    CHECK(values[base + CPipelineMetrics::BUCKET_COUNT + 1] == G_MAXINT);
+
+    // Other histograms are untouched
+    CHECK(values[base - 2] == 0);
+    CHECK(values[base + CPipelineMetrics::HISTOGRAM_SNAPSHOT_SIZE] == 0);
+
+    CPipelineMetrics::Release(pMetrics);
+}
+
+static void check_counters()
+{
+    CPipelineMetrics *pMetrics = CPipelineMetrics::Create();
+    int64_t values[CPipelineMetrics::SNAPSHOT_SIZE];
+
+    pMetrics->Increment(CPipelineMetrics::FRAMES_DECODED);
+    pMetrics->Increment(CPipelineMetrics::FRAMES_DECODED);
+    pMetrics->Add(CPipelineMetrics::FRAMES_DROPPED, 7);
+    pMetrics->Add(CPipelineMetrics::FRAMES_DROPPED, 3);
+    pMetrics->Set(CPipelineMetrics::AV_DRIFT_MICROS, -40);
+    pMetrics->Snapshot(values);
+
+    CHECK(values[CPipelineMetrics::FRAMES_DECODED] == 2);
+    CHECK(values[CPipelineMetrics::FRAMES_RENDERED] == 0);
+    CHECK(values[CPipelineMetrics::FRAMES_DROPPED] == 10);
+    CHECK(values[CPipelineMetrics::AV_DRIFT_MICROS] == -40);
+
+    CHECK(CPipelineMetrics::AddRef(pMetrics) == pMetrics);
+    CPipelineMetrics::Release(pMetrics);
+    CPipelineMetrics::Release(pMetrics);
+}
+
+static void check_stamps()
+{
+    CFrameStamps stamps;
+    int64_t time = 0;
+
+    CHECK(!stamps.Take(1, &time));
+
+    // Taken out of order, and only once
+    stamps.Stamp(1, 100);
+    stamps.Stamp(2, 200);
+    stamps.Stamp(3, 300);
+    CHECK(stamps.Take(3, &time) && time == 300);
+    CHECK(stamps.Take(1, &time) && time == 100);
+    CHECK(!stamps.Take(1, &time));
+
+    stamps.Clear();
+    CHECK(!stamps.Take(2, &time));
+
+    // The oldest stamps are overwritten once the ring is full
+    for (int i = 0; i < 40; i++)
+        stamps.Stamp(1000 + i, i);
+    CHECK(!stamps.Take(1000, &time));
+    CHECK(!stamps.Take(1007, &time));
+    CHECK(stamps.Take(1008, &time) && time == 8);
+    CHECK(stamps.Take(1039, &time) && time == 39);
+}
+
+// The producer stamps ts with time ts * 2 + 1 while the consumer takes every
+// stamp, so any torn or stale slot shows up as a wrong time. The producer runs
+// up to STRESS_AHEAD stamps ahead, rewriting slots while they are scanned.
+#define STRESS_STAMPS   2000000
+#define STRESS_AHEAD    16
+
+static CFrameStamps stress_stamps;
+static volatile gint stress_produced = 0;
+static volatile gint stress_consumed = 0;
+
+static gpointer stress_producer(gpointer)
+{
+    for (gint ts = 1; ts <= STRESS_STAMPS; ts++)
+    {
+        while (ts - g_atomic_int_get(&stress_consumed) > STRESS_AHEAD)
+            g_thread_yield();
+        stress_stamps.Stamp(ts, (int64_t)ts * 2 + 1);
+        g_atomic_int_set(&stress_produced, ts);
+    }
+    return NULL;
+}
+
+static void check_stamps_concurrent()
+{
+    GThread *pProducer = g_thread_new("producer", stress_producer, NULL);
+    int64_t taken = 0, bad = 0, time = 0;
+
+    for (gint ts = 1; ts <= STRESS_STAMPS; ts++)
+    {
+        while (g_atomic_int_get(&stress_produced) < ts)
+            g_thread_yield();
+        if (stress_stamps.Take(ts, &time))
+        {
+            taken++;
+            if (time != (int64_t)ts * 2 + 1)
+                bad++;
+        }
+        // Race Clear() against the producer now and then, as a flush would
+        if (ts % 4096 == 0)
+            stress_stamps.Clear();
+        g_atomic_int_set(&stress_consumed, ts);
+    }
+
+    g_thread_join(pProducer);
+
+    CHECK(bad == 0);
+    CHECK(taken > STRESS_STAMPS / 2);
+    printf("frame stamps: %lld of %d taken concurrently\n", (long long)taken, STRESS_STAMPS);
+}
+
+int main()
+{
+    check_histogram();
+    check_counters();
+    check_stamps();
+    check_stamps_concurrent();
+
+    if (failures > 0)
+        fprintf(stderr, "pipeline metrics: %d checks failed\n", failures);
+    else
+        printf("pipeline metrics: all checks passed\n");
+
+    return failures > 0 ? 1 : 0;
+}
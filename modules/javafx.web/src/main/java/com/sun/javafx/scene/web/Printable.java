@@ -32,6 +32,7 @@ import com.sun.prism.Graphics;
 import com.sun.webkit.WebPage;
 import com.sun.webkit.graphics.WCGraphicsContext;
 import com.sun.webkit.graphics.WCGraphicsManager;
+import com.sun.webkit.graphics.WCRenderQueue;
 import javafx.scene.Node;
 
 public final class Printable extends Node {
@@ -64,6 +65,16 @@ public final class Printable extends Node {
         PrintableHelper.initHelper(this);
     }
 
+    /*
+     * Creates a printable for a page recorded with WebPage.recordPrintPages.
+     * The queue is replayed on every render and is not disposed here.
+     */
+    public Printable(WCRenderQueue rq) {
+        this.page = null;
+        peer = new RecordedPeer(rq);
+        PrintableHelper.initHelper(this);
+    }
+
     private NGNode doCreatePeer() {
         return peer;
     }
@@ -101,4 +112,22 @@ public final class Printable extends Node {
             return false;
         }
     }
+
+    private static final class RecordedPeer extends NGNode {
+        private final WCRenderQueue rq;
+
+        RecordedPeer(WCRenderQueue rq) {
+            this.rq = rq;
+        }
+
+        @Override protected void renderContent(Graphics g) {
+            WCGraphicsContext gc = WCGraphicsManager.getGraphicsManager().
+                    createGraphicsContext(g);
+            rq.replay(gc);
+        }
+
+        @Override protected boolean hasOverlappingContents() {
+            return false;
+        }
+    }
 }
@@ -27,8 +27,13 @@ package com.sun.javafx.webkit.prism;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.javafx.logging.PlatformLogger;
 import com.sun.media.jfxmedia.MediaManager;
 import com.sun.prism.Graphics;
+import com.sun.prism.GraphicsPipeline;
+import com.sun.prism.RTTexture;
+import com.sun.prism.ResourceFactory;
+import com.sun.prism.Texture;
 import com.sun.webkit.perf.WCFontPerfLogger;
 import com.sun.webkit.perf.WCGraphicsPerfLogger;
 import com.sun.webkit.graphics.*;
@@ -36,9 +41,13 @@ import java.io.IOException;
 import java.io.InputStream;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.nio.IntBuffer;
 
 public final class PrismGraphicsManager extends WCGraphicsManager {
 
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(PrismGraphicsManager.class.getName());
+
     private final static float highestPixelScale;
     private final static BaseTransform pixelScaleTransform;
 
@@ -102,6 +111,70 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return new WCPageBackBufferImpl(highestPixelScale);
     }
 
+    @Override
+    public ByteBuffer renderOffscreen(WCRenderQueue rq,
+                                      int x, int y, int w, int h,
+                                      float scale)
+    {
+        final int pw = (int) Math.ceil(w * scale);
+        final int ph = (int) Math.ceil(h * scale);
+        final ByteBuffer[] result = new ByteBuffer[1];
+        PrismInvoker.runOnRenderThread(() -> {
+            RTTexture t = null;
+            try {
+                ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
+                if (f == null || f.isDisposed()) {
+                    log.fine("PrismGraphicsManager::renderOffscreen : no resource factory");
+                    return;
+                }
+                t = f.createRTTexture(pw, ph, Texture.WrapMode.CLAMP_NOT_NEEDED);
+                if (t == null) {
+                    log.fine("PrismGraphicsManager::renderOffscreen : cannot create a " + pw + "x" + ph + " texture");
+                    return;
+                }
+                Graphics g = t.createGraphics();
+                g.clear();
+                g.scale(scale, scale);
+                g.translate(-x, -y);
+                WCGraphicsContext gc = createGraphicsContext(g);
+                rq.decode(gc);
+                gc.flush();
+
+                // Both INT_ARGB_PRE and BYTE_BGRA_PRE read back as
+                // premultiplied ARGB ints in native byte order
+                int[] pixels = t.getPixels();
+                if (pixels == null) {
+                    IntBuffer ib = IntBuffer.allocate(pw * ph);
+                    t.readPixels(ib);
+                    pixels = ib.array();
+                }
+                ByteBuffer rgba = ByteBuffer.allocateDirect(pw * ph * 4);
+                for (int argb : pixels) {
+                    int a = argb >>> 24;
+                    int r = (argb >> 16) & 0xff;
+                    int gr = (argb >> 8) & 0xff;
+                    int b = argb & 0xff;
+                    if (a != 0 && a != 0xff) {
+                        r = Math.min(0xff, (r * 0xff + a / 2) / a);
+                        gr = Math.min(0xff, (gr * 0xff + a / 2) / a);
+                        b = Math.min(0xff, (b * 0xff + a / 2) / a);
+                    }
+                    rgba.put((byte) r).put((byte) gr).put((byte) b).put((byte) a);
+                }
+                rgba.rewind();
+                result[0] = rgba;
+            } finally {
+                // decode() disposes the queue itself, but not if we gave up
+                // or failed before it ran
+                rq.dispose();
+                if (t != null) {
+                    t.dispose();
+                }
+            }
+        });
+        return result[0];
+    }
+
     @Override
     protected WCPath createWCPath() {
         return new WCPathImpl();
@@ -143,13 +216,6 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         };
     }
 
-    @Override
-    protected WCTransform createTransform(double m00, double m10, double m01,
-            double m11, double m02, double m12)
-    {
-        return new WCTransform(m00, m10, m01, m11, m02, m12);
-    }
-
     @Override
     protected String[] getSupportedMediaTypes() {
         String[] types = MediaManager.getSupportedContentTypes();
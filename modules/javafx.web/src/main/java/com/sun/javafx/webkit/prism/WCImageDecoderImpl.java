@@ -41,6 +41,10 @@ import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import java.util.Arrays;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -48,21 +52,47 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     private final static PlatformLogger log;
 
+    // Images of at least this many decoded bytes are decoded on the decode
+    // pool as soon as their data is complete, rather than on first paint
+    private final static int PREDECODE_MIN_BYTES = 500 * 1024;
+
+    // Upper bound on the decoded bytes of images queued or running on the
+    // decode pool. Images that do not fit are decoded on first paint, so
+    // a page full of large images cannot pin more than this ahead of time.
+    private final static long PREDECODE_BUDGET_BYTES = 32L * 1024 * 1024;
+
+    private final static ExecutorService decodePool;
+    private final static AtomicLong predecodeBytes = new AtomicLong();
+
     private Service<ImageFrame[]> loader;
 
-    private int imageWidth = 0;
-    private int imageHeight = 0;
+    // Written by whichever thread decodes, read without the lock
+    private volatile int imageWidth = 0;
+    private volatile int imageHeight = 0;
+    private volatile String fileNameExtension;
     private ImageFrame[] frames;
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
-    private boolean fullDataReceived = false;
+    private volatile boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
+    private boolean decodeFailed = false; // the complete data could not be decoded
+    private boolean decoding = false; // a thread is decoding the complete data
+    private int generation = 0; // incremented when decoded frames are destroyed
     private PrismImage[] images;
     private volatile byte[] data;
     private volatile int dataSize = 0;
-    private String fileNameExtension;
 
     static {
         log = PlatformLogger.getLogger(WCImageDecoderImpl.class.getName());
+
+        final AtomicInteger threadCount = new AtomicInteger();
+        int poolSize = Math.max(1, Math.min(4,
+                Runtime.getRuntime().availableProcessors() / 2));
+        decodePool = Executors.newFixedThreadPool(poolSize, r -> {
+            Thread t = new Thread(r, "WebImageDecoder-" + threadCount.incrementAndGet());
+            t.setDaemon(true);
+            t.setPriority(Thread.NORM_PRIORITY - 1);
+            return t;
+        });
     }
 
     /*
@@ -80,6 +110,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         frames = null;
         images = null;
         framesDecoded = false;
+        generation++;
     }
 
     @Override protected String getFilenameExtension() {
@@ -93,6 +124,9 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     @Override protected void addImageData(byte[] dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            synchronized (this) {
+                decodeFailed = false;
+            }
             if (data == null) {
                 data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
                 dataSize = dataPortion.length;
@@ -114,7 +148,41 @@ final class WCImageDecoderImpl extends WCImageDecoder {
                 resizeDataArray(dataSize);
             }
             fullDataReceived = true;
+            schedulePredecode();
+        }
+    }
+
+    // Starts decoding a large image on the decode pool, within the budget
+    private void schedulePredecode() {
+        final long bytes = (long) imageWidth * imageHeight * 4;
+        if (bytes < PREDECODE_MIN_BYTES) {
+            return;
+        }
+        long pending;
+        do {
+            pending = predecodeBytes.get();
+            if (pending + bytes > PREDECODE_BUDGET_BYTES) {
+                return;
+            }
+        } while (!predecodeBytes.compareAndSet(pending, pending + bytes));
+
+        final int gen;
+        synchronized (this) {
+            gen = generation;
         }
+        decodePool.execute(() -> {
+            try {
+                // Skip the decode if the frames were destroyed meanwhile
+                synchronized (this) {
+                    if (gen != generation) {
+                        return;
+                    }
+                }
+                getImageFrame(0);
+            } finally {
+                predecodeBytes.addAndGet(-bytes);
+            }
+        });
     }
 
     private void destroyLoader() {
@@ -171,7 +239,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         setFrames(loadFrames(in));
     }
 
-    private synchronized ImageFrame[] loadFrames(InputStream in) {
+    private ImageFrame[] loadFrames(InputStream in) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("%X Decoding frames", hashCode()));
         }
@@ -202,15 +270,18 @@ final class WCImageDecoderImpl extends WCImageDecoder {
                 log.fine(String.format("%X Image size %dx%d",
                         hashCode(), metadata.imageWidth, metadata.imageHeight));
             }
-            // The following lines is a workaround for RT-13475,
-            // because image decoder does not report valid image size
-            if (imageWidth < metadata.imageWidth) {
-                imageWidth = metadata.imageWidth;
-            }
-            if (imageHeight < metadata.imageHeight) {
-                imageHeight = metadata.imageHeight;
+            // The loader and the decode pool may report concurrently
+            synchronized (WCImageDecoderImpl.this) {
+                // The following lines is a workaround for RT-13475,
+                // because image decoder does not report valid image size
+                if (imageWidth < metadata.imageWidth) {
+                    imageWidth = metadata.imageWidth;
+                }
+                if (imageHeight < metadata.imageHeight) {
+                    imageHeight = metadata.imageHeight;
+                }
+                fileNameExtension = l.getFormatDescription().getExtensions().get(0);
             }
-            fileNameExtension = l.getFormatDescription().getExtensions().get(0);
         }
     };
 
@@ -255,6 +326,21 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     @Override protected int getFrameCount() {
+        synchronized (this) {
+            if (decodeFailed) {
+                return 0;
+            }
+            if (framesDecoded) {
+                return frameCount;
+            }
+        }
+        // Only GIF images may have more than one frame, so other images
+        // whose header could be read do not need to be decoded to answer
+        // this. If their complete decode fails later, the count drops to 0.
+        if (fullDataReceived && imageSizeAvilable()
+                && !"gif".equalsIgnoreCase(fileNameExtension)) {
+            return 1;
+        }
         // Initiate full decode to get frame count.
         // NOTE: This method will be called just before
         // rendering the given image, so there will not
@@ -263,12 +349,15 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         if (fullDataReceived) {
             getImageFrame(0);
         }
-        return frameCount;
+        synchronized (this) {
+            return decodeFailed ? 0 : frameCount;
+        }
     }
 
-    // Avoid redundant decoding by async decoder threads, currently we don't
-    // support per frame decoding.
-    @Override protected synchronized WCImageFrame getFrame(int idx) {
+    // May be called on the WebKit main thread and on the threads of the
+    // asynchronous decoding queue of WebCore; concurrent calls share a
+    // single decoding of the complete data (see getImageFrame).
+    @Override protected WCImageFrame getFrame(int idx) {
         ImageFrame frame = getImageFrame(idx);
         if (frame != null) {
             if (log.isLoggable(Level.FINE)) {
@@ -324,20 +413,76 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return getFrameMetadata(idx) != null && framesDecoded;
     }
 
-    private synchronized ImageFrame getImageFrame(int idx) {
-        if (!fullDataReceived) {
-            startLoader();
-        } else if (fullDataReceived && !framesDecoded) {
-            destroyLoader();
-            setFrames(loadFrames()); // re-decode frames if they have been destroyed
-            framesDecoded = true;
+    ImageFrame getImageFrame(int idx) {
+        while (true) {
+            synchronized (this) {
+                if (fullDataReceived && !framesDecoded) {
+                    if (decoding) {
+                        // Another thread is decoding, wait for its frames
+                        try {
+                            wait();
+                        } catch (InterruptedException e) {
+                            Thread.currentThread().interrupt();
+                            return getDecodedFrame(idx);
+                        }
+                        continue;
+                    }
+                    destroyLoader();
+                    decoding = true;
+                } else {
+                    if (!fullDataReceived) {
+                        startLoader();
+                    }
+                    return getDecodedFrame(idx);
+                }
+            }
+            // re-decode frames if they have been destroyed
+            decodeFrames();
         }
+    }
+
+    private synchronized ImageFrame getDecodedFrame(int idx) {
         return (idx >= 0) && (this.frames != null) && (this.frames.length > idx)
                 ? this.frames[idx]
                 : null;
     }
 
+    // Decodes the complete data without holding the lock, so that the
+    // decoder can still be queried while its frames are being decoded.
+    private void decodeFrames() {
+        final int gen;
+        synchronized (this) {
+            gen = generation;
+        }
+        long start = System.nanoTime();
+        ImageFrame[] decoded = null;
+        try {
+            decoded = loadFrames();
+        } finally {
+            long time = System.nanoTime() - start;
+            recordDecodeTime(time);
+            if (log.isLoggable(Level.FINE)) {
+                log.fine(String.format("%X Decoded %dx%d in %d us on %s",
+                        hashCode(), imageWidth, imageHeight, time / 1000,
+                        Thread.currentThread().getName()));
+            }
+            synchronized (this) {
+                if (gen == generation) {
+                    setFrames(decoded);
+                    framesDecoded = true;
+                }
+                decodeFailed = decoded == null || decoded.length == 0;
+                decoding = false;
+                notifyAll();
+            }
+        }
+    }
+
     private synchronized PrismImage getPrismImage(int idx, ImageFrame frame) {
+        if (this.frames == null) {
+            // The frames were destroyed after [frame] was obtained
+            return new WCImageImpl(frame);
+        }
         if (this.images == null) {
             this.images = new PrismImage[this.frames.length];
         }
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.webkit.graphics.WCRectangle;
+import com.sun.webkit.graphics.WCRenderQueue;
+import java.util.Collections;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Set;
+import java.util.WeakHashMap;
+
+/**
+ * A cache of render queues recorded for fixed-size tiles of the page
+ * viewport. A tile that has not been invalidated since it was recorded
+ * can be replayed instead of being painted from the render tree again.
+ *
+ * The cache holds at most {@code MAX_TILES} tiles and {@code maxBytes} of
+ * recorded commands; the least recently used tiles are dropped first.
+ * All caches are emptied when WebCore is asked to release memory.
+ *
+ * The cache itself is accessed on the event thread only. Entries are
+ * reference counted because render frames that replay them are decoded
+ * on the render thread, possibly after the entry has been invalidated.
+ */
+final class DisplayListCache {
+
+    static final int TILE_SIZE = 256;
+
+    private static final int MAX_TILES = 256;
+
+    private static final long maxBytes = Long.getLong(
+            "com.sun.webkit.displayListCacheSize", 16L << 20);
+
+    // Live caches, so that releaseMemory can empty them all
+    private static final Set<DisplayListCache> caches =
+            Collections.newSetFromMap(new WeakHashMap<DisplayListCache, Boolean>());
+
+    static final class Entry {
+        private final WCRenderQueue rq;
+        private int size;
+        private int users;
+        private boolean retired;
+
+        private Entry(WCRenderQueue rq) {
+            this.rq = rq;
+        }
+
+        WCRenderQueue getRenderQueue() {
+            return rq;
+        }
+
+        synchronized void acquire() {
+            users++;
+        }
+
+        synchronized void release() {
+            if (--users == 0 && retired) {
+                rq.dispose();
+            }
+        }
+
+        private synchronized boolean isRetired() {
+            return retired;
+        }
+
+        private synchronized void retire() {
+            retired = true;
+            if (users == 0) {
+                rq.dispose();
+            }
+        }
+    }
+
+    // In access order, so that the eldest entry is the least recently used
+    private final LinkedHashMap<Long, Entry> tiles =
+            new LinkedHashMap<Long, Entry>(16, 0.75f, true);
+    private long bytes;
+    private long replayCount;
+    private long repaintCount;
+
+    DisplayListCache() {
+        caches.add(this);
+    }
+
+    /**
+     * Empties every cache, called on the event thread.
+     */
+    static void clearAll() {
+        for (DisplayListCache cache : caches) {
+            cache.clear();
+        }
+    }
+
+    private static long key(int col, int row) {
+        return ((long) col << 32) | (row & 0xffffffffL);
+    }
+
+    static WCRectangle getTileRect(int col, int row) {
+        return new WCRectangle(col * TILE_SIZE, row * TILE_SIZE,
+                               TILE_SIZE, TILE_SIZE);
+    }
+
+    /**
+     * Returns the recorded entry for the given tile, acquired on behalf of
+     * the caller, or {@code null} if the tile has to be painted.
+     */
+    Entry replay(int col, int row) {
+        Entry e = tiles.get(key(col, row));
+        if (e == null) {
+            return null;
+        }
+        e.acquire();
+        replayCount++;
+        return e;
+    }
+
+    /**
+     * Creates and caches an entry for the given tile that the caller
+     * records into. The entry is acquired on behalf of the caller, who
+     * must call {@link #recorded} once the queue is filled.
+     * It is cached before recording so that any invalidation issued
+     * while painting retires it.
+     */
+    Entry record(int col, int row, WCRenderQueue rq) {
+        Entry e = new Entry(rq);
+        e.acquire();
+        remove(tiles.put(key(col, row), e));
+        repaintCount++;
+        return e;
+    }
+
+    /**
+     * Accounts for the commands recorded into an entry and drops the least
+     * recently used tiles while the cache is over its limits.
+     */
+    void recorded(Entry e) {
+        // An invalidation while painting may have dropped it already
+        if (!e.isRetired()) {
+            e.size = e.rq.getSize();
+            bytes += e.size;
+        }
+        Iterator<Entry> it = tiles.values().iterator();
+        while ((tiles.size() > MAX_TILES || bytes > maxBytes) && it.hasNext()) {
+            Entry eldest = it.next();
+            it.remove();
+            remove(eldest);
+        }
+    }
+
+    private void remove(Entry e) {
+        if (e != null) {
+            bytes -= e.size;
+            e.retire();
+        }
+    }
+
+    /**
+     * Drops the tiles that intersect the given rectangle.
+     */
+    void invalidate(WCRectangle r) {
+        if (tiles.isEmpty() || r.getWidth() <= 0 || r.getHeight() <= 0) {
+            return;
+        }
+        int col0 = Math.floorDiv(r.getIntX(), TILE_SIZE);
+        int row0 = Math.floorDiv(r.getIntY(), TILE_SIZE);
+        int col1 = Math.floorDiv(r.getIntX() + r.getIntWidth() - 1, TILE_SIZE);
+        int row1 = Math.floorDiv(r.getIntY() + r.getIntHeight() - 1, TILE_SIZE);
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                remove(tiles.remove(key(col, row)));
+            }
+        }
+    }
+
+    void clear() {
+        for (Iterator<Entry> it = tiles.values().iterator(); it.hasNext();) {
+            it.next().retire();
+            it.remove();
+        }
+        bytes = 0;
+    }
+
+    long getReplayCount() {
+        return replayCount;
+    }
+
+    long getRepaintCount() {
+        return repaintCount;
+    }
+
+    int getTileCount() {
+        return tiles.size();
+    }
+}
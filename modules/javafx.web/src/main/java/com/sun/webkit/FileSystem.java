@@ -36,6 +36,7 @@ import java.nio.channels.FileChannel;
 import java.nio.file.Files;
 import java.nio.file.InvalidPathException;
 import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
 
 final class FileSystem {
 
@@ -52,6 +53,35 @@ final class FileSystem {
         throw new AssertionError();
     }
 
+    /**
+     * Native code accesses the file system directly, bypassing this class,
+     * only when there is no security policy that these methods would enforce.
+     */
+    private static boolean fwkUseNativeFileSystem() {
+        @SuppressWarnings("removal")
+        SecurityManager securityManager = System.getSecurityManager();
+        return securityManager == null;
+    }
+
+    private static boolean fwkCheckFileAccess(String path, boolean write) {
+        @SuppressWarnings("removal")
+        SecurityManager securityManager = System.getSecurityManager();
+        if (securityManager == null) {
+            return true;
+        }
+        try {
+            if (write) {
+                securityManager.checkWrite(path);
+            } else {
+                securityManager.checkRead(path);
+            }
+            return true;
+        } catch (SecurityException ex) {
+            logger.fine(format("Access denied to file [%s]", path), ex);
+            return false;
+        }
+    }
+
     private static boolean fwkFileExists(String path) {
         return new File(path).exists();
     }
@@ -83,6 +113,26 @@ final class FileSystem {
         return -1;
     }
 
+    private static int fwkWriteToFile(RandomAccessFile raf, ByteBuffer byteBuffer) {
+        try {
+            FileChannel fc = raf.getChannel();
+            return fc.write(byteBuffer);
+        } catch (IOException ex) {
+            logger.fine(format("Error while writing RandomAccessFile for file [%s]", raf), ex);
+        }
+        return -1;
+    }
+
+    private static boolean fwkTruncateFile(RandomAccessFile raf, long length) {
+        try {
+            raf.setLength(length);
+            return true;
+        } catch (IOException ex) {
+            logger.fine(format("Error while truncating RandomAccessFile for file [%s]", raf), ex);
+        }
+        return false;
+    }
+
     private static void fwkSeekFile(RandomAccessFile raf, long pos) {
         try {
             raf.seek(pos);
@@ -143,4 +193,42 @@ final class FileSystem {
     private static String fwkPathGetFileName(String path) {
         return new File(path).getName();
     }
+
+    private static String[] fwkListDirectory(String path) {
+        try {
+            return new File(path).list();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error listing directory [%s]", path), ex);
+            return null;
+        }
+    }
+
+    private static boolean fwkDeletePath(String path, boolean directory) {
+        try {
+            File file = new File(path);
+            if (file.isDirectory() != directory) {
+                return false;
+            }
+            Files.delete(file.toPath());
+            return true;
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error deleting [%s]", path), ex);
+            return false;
+        }
+    }
+
+    private static boolean fwkMoveFile(String oldPath, String newPath) {
+        try {
+            Files.move(Paths.get(oldPath), Paths.get(newPath),
+                       StandardCopyOption.REPLACE_EXISTING);
+            return true;
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error moving [%s] to [%s]", oldPath, newPath), ex);
+            return false;
+        }
+    }
+
+    private static String fwkParentPath(String path) {
+        return new File(path).getParent();
+    }
 }
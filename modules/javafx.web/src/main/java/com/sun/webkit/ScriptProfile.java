@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Locale;
+
+/**
+ * JavaScript stack samples collected between {@link WebPage#startSamplingProfiler}
+ * and {@link WebPage#stopSamplingProfiler}, aggregated by stack. Identical
+ * frames share one frame index and identical stacks are counted once.
+ */
+public final class ScriptProfile {
+    private static final int VERSION = 1;
+
+    /**
+     * The execution tier a frame was sampled in.
+     */
+    public enum Tier {
+        UNKNOWN,
+        /** The low level interpreter. */
+        LLINT,
+        BASELINE,
+        DFG,
+        FTL,
+        /** A native function called from JavaScript. */
+        HOST,
+        WASM,
+        REGEXP,
+        /** Native code outside of JavaScript, such as the JIT or the GC. */
+        NATIVE
+    }
+
+    private static final Tier[] TIERS = Tier.values();
+
+    private final int sampleCount;
+    private final String[] strings;
+    private final int[] frames;
+    private final int[] stackSampleCounts;
+    private final int[][] stacks;
+
+    ScriptProfile(byte[] data) {
+        ByteBuffer buffer = ByteBuffer.wrap(data).order(ByteOrder.nativeOrder());
+        int version = buffer.getInt();
+        if (version != VERSION) {
+            throw new IllegalStateException("Unsupported profile version " + version);
+        }
+        sampleCount = buffer.getInt();
+        int stringCount = buffer.getInt();
+        int frameCount = buffer.getInt();
+        int stackCount = buffer.getInt();
+
+        strings = new String[stringCount];
+        for (int i = 0; i < stringCount; i++) {
+            char[] chars = new char[buffer.getInt()];
+            buffer.asCharBuffer().get(chars);
+            buffer.position(buffer.position() + 2 * chars.length);
+            strings[i] = new String(chars);
+        }
+
+        frames = new int[6 * frameCount];
+        buffer.asIntBuffer().get(frames);
+        buffer.position(buffer.position() + 4 * frames.length);
+
+        stackSampleCounts = new int[stackCount];
+        stacks = new int[stackCount][];
+        for (int i = 0; i < stackCount; i++) {
+            stackSampleCounts[i] = buffer.getInt();
+            stacks[i] = new int[buffer.getInt()];
+            buffer.asIntBuffer().get(stacks[i]);
+            buffer.position(buffer.position() + 4 * stacks[i].length);
+        }
+    }
+
+    private String string(int index) {
+        return index < 0 ? null : strings[index];
+    }
+
+    /**
+     * Returns the number of samples taken, including samples without any
+     * JavaScript frame, which belong to no stack.
+     */
+    public int getSampleCount() {
+        return sampleCount;
+    }
+
+    public int getFrameCount() {
+        return frames.length / 6;
+    }
+
+    /**
+     * Returns the function name of a frame, or a placeholder such as
+     * {@code (program)} for top level script code.
+     */
+    public String getFunctionName(int frame) {
+        return string(frames[6 * frame]);
+    }
+
+    /**
+     * Returns the URL of the script of a frame, which is empty for frames
+     * without a script, such as native functions.
+     */
+    public String getURL(int frame) {
+        return string(frames[6 * frame + 1]);
+    }
+
+    /**
+     * Returns the line the function of a frame starts on, or -1.
+     */
+    public int getFunctionLine(int frame) {
+        return frames[6 * frame + 2];
+    }
+
+    /**
+     * Returns the line of the expression being executed in a frame, or -1.
+     */
+    public int getLine(int frame) {
+        return frames[6 * frame + 3];
+    }
+
+    /**
+     * Returns the column of the expression being executed in a frame, or -1.
+     */
+    public int getColumn(int frame) {
+        return frames[6 * frame + 4];
+    }
+
+    public Tier getTier(int frame) {
+        int tier = frames[6 * frame + 5];
+        return tier >= 0 && tier < TIERS.length ? TIERS[tier] : Tier.UNKNOWN;
+    }
+
+    public int getStackCount() {
+        return stacks.length;
+    }
+
+    /**
+     * Returns how many samples had the given stack.
+     */
+    public int getStackSampleCount(int stack) {
+        return stackSampleCounts[stack];
+    }
+
+    /**
+     * Returns the frame indices of a stack, innermost frame first.
+     */
+    public int[] getStackFrames(int stack) {
+        return stacks[stack].clone();
+    }
+
+    /**
+     * Returns the stacks in the folded format read by flame graph tools:
+     * one line per stack with the frames, outermost first, separated by
+     * {@code ;} and followed by the sample count. A frame is written as
+     * {@code name (url:line) [tier]}.
+     */
+    public String toFoldedStacks() {
+        StringBuilder sb = new StringBuilder();
+        for (int i = 0; i < stacks.length; i++) {
+            int[] stack = stacks[i];
+            for (int j = stack.length - 1; j >= 0; j--) {
+                appendFrame(sb, stack[j]);
+                sb.append(j > 0 ? ';' : ' ');
+            }
+            sb.append(stackSampleCounts[i]).append('\n');
+        }
+        return sb.toString();
+    }
+
+    private void appendFrame(StringBuilder sb, int frame) {
+        // ';' separates frames, so it may not appear in a frame. Flame graph
+        // tools take the count after the last space, so other spaces are fine.
+        String name = getFunctionName(frame);
+        sb.append(name == null || name.isEmpty() ? "(anonymous)" : name.replace(';', ','));
+        String url = getURL(frame);
+        int line = getLine(frame) >= 0 ? getLine(frame) : getFunctionLine(frame);
+        if (url != null && !url.isEmpty()) {
+            sb.append(" (").append(url.replace(';', ','));
+            if (line >= 0) {
+                sb.append(':').append(line);
+            }
+            sb.append(')');
+        }
+        sb.append(" [").append(getTier(frame).name().toLowerCase(Locale.ROOT)).append(']');
+    }
+}
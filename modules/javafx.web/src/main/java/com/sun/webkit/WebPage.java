@@ -27,9 +27,14 @@ package com.sun.webkit;
 
 import javafx.application.ConditionalFeature;
 import javafx.application.Platform;
+import javafx.print.JobSettings;
+import javafx.print.PageLayout;
+import javafx.print.PageRange;
+import javafx.print.PrinterJob;
 import com.sun.glass.utils.NativeLibLoader;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.javafx.scene.web.Printable;
 import com.sun.webkit.event.WCFocusEvent;
 import com.sun.webkit.event.WCInputMethodEvent;
 import com.sun.webkit.event.WCKeyEvent;
@@ -49,6 +54,7 @@ import java.security.PrivilegedAction;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.IdentityHashMap;
 import java.util.Iterator;
 import java.util.LinkedList;
 import java.util.List;
@@ -57,9 +63,12 @@ import java.util.Queue;
 import java.util.Set;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Future;
 import java.util.concurrent.FutureTask;
 import java.util.concurrent.atomic.AtomicReference;
 import java.util.concurrent.locks.ReentrantLock;
+import java.util.function.BiConsumer;
+import java.util.function.Consumer;
 import netscape.javascript.JSException;
 import org.w3c.dom.Document;
 import org.w3c.dom.Element;
@@ -83,6 +92,9 @@ public final class WebPage {
 
     private static final int MAX_FRAME_QUEUE_SIZE = 10;
 
+    private static boolean useDisplayListCache;
+    private static boolean useSpeculativeHTMLTokenization;
+
     // Native WebPage* pointer
     private long pPage = 0;
 
@@ -126,6 +138,12 @@ public final class WebPage {
     // Accessed on: Event thread only.
     private RenderFrame currentFrame = new RenderFrame();
 
+    // Recorded viewport tiles that can be replayed instead of repainted,
+    // or null if the cache is disabled.
+    // Accessed on: Event thread only.
+    private DisplayListCache displayListCache =
+            useDisplayListCache ? new DisplayListCache() : null;
+
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
@@ -148,6 +166,13 @@ public final class WebPage {
                     "com.sun.webkit.useJIT", "true"));
             final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useDFGJIT", "true"));
+            final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useFTLJIT", "true"));
+
+            useDisplayListCache = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useDisplayListCache", "false"));
+            useSpeculativeHTMLTokenization = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useSpeculativeHTMLTokenization", "false"));
 
             // TODO: Enable CSS3D by default once it is stabilized.
             boolean useCSS3D = Boolean.valueOf(System.getProperty(
@@ -155,7 +180,7 @@ public final class WebPage {
             useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
             // Initialize WTF, WebCore and JavaScriptCore.
-            twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+            twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useCSS3D);
             return null;
         });
 
@@ -170,6 +195,7 @@ public final class WebPage {
         Disposer.addRecord(new Object(), WebPage::collectJSCGarbages);
         // Invoke JavaScriptCore GC.
         twkDoJSCGarbageCollection();
+        checkHeapPressure();
     }
 
     public WebPage(WebPageClient pageClient,
@@ -201,6 +227,9 @@ public final class WebPage {
         pPage = twkCreatePage(editable);
 
         twkInit(pPage, false, WCGraphicsManager.getGraphicsManager().getDevicePixelScale());
+        if (useSpeculativeHTMLTokenization) {
+            twkOverridePreference(pPage, "SpeculativeHTMLTokenizationEnabled", "true");
+        }
 
         if (pageClient != null && pageClient.isBackBufferSupported()) {
             backbuffer = pageClient.createBackBuffer();
@@ -287,6 +316,35 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Returns the number of viewport tiles replayed from recorded display
+     * lists instead of being painted from the render tree. Always zero
+     * unless {@code com.sun.webkit.useDisplayListCache} is set to true.
+     */
+    public long getReplayedTileCount() {
+        lockPage();
+        try {
+            return displayListCache != null
+                    ? displayListCache.getReplayCount() : 0;
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the number of viewport tiles painted from the render tree
+     * and recorded for later replay.
+     */
+    public long getRepaintedTileCount() {
+        lockPage();
+        try {
+            return displayListCache != null
+                    ? displayListCache.getRepaintCount() : 0;
+        } finally {
+            unlockPage();
+        }
+    }
+
     private void updateDirty(WCRectangle clip) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Entering, dirtyRects: {0}, currentFrame: {1}",
@@ -312,11 +370,11 @@ public final class WebPage {
                 continue;
             }
             paintLog.finest("Updating: {0}", r);
-            WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
-                    .createRenderQueue(r, true);
-            twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
-                             r.getIntWidth() + 2, r.getIntHeight() + 2);
-            currentFrame.addRenderQueue(rq);
+            if (displayListCache != null) {
+                updateTiles(r, clip);
+            } else {
+                updateRect(r);
+            }
         }
         {
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
@@ -359,7 +417,7 @@ public final class WebPage {
                     paintLog.finest("Frame queue exceeded maximum "
                             + "size, clearing and requesting full repaint");
                     dropRenderFrames();
-                    repaintAll();
+                    restoreAll();
                 }
 
                 paintLog.finest("Frame queue updated, frameQueue: {0}", frameQueue);
@@ -372,6 +430,46 @@ public final class WebPage {
         }
     }
 
+    private void updateRect(WCRectangle r) {
+        WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(r, true);
+        twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
+                         r.getIntWidth() + 2, r.getIntHeight() + 2);
+        currentFrame.addRenderQueue(rq);
+    }
+
+    // Paints the dirty rect [r] tile by tile. Every tile (clipped to the
+    // viewport) that [r] touches is replayed from the display list cache if
+    // it has not been invalidated since it was recorded, and is recorded
+    // into the cache in full otherwise.
+    private void updateTiles(WCRectangle r, WCRectangle clip) {
+        final int ts = DisplayListCache.TILE_SIZE;
+        int col0 = Math.floorDiv(r.getIntX(), ts);
+        int row0 = Math.floorDiv(r.getIntY(), ts);
+        int col1 = Math.floorDiv(r.getIntX() + r.getIntWidth() - 1, ts);
+        int row1 = Math.floorDiv(r.getIntY() + r.getIntHeight() - 1, ts);
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                WCRectangle tile = DisplayListCache.getTileRect(col, row)
+                        .intersection(clip);
+                if (tile.getWidth() <= 0 || tile.getHeight() <= 0) {
+                    continue;
+                }
+                DisplayListCache.Entry e = displayListCache.replay(col, row);
+                if (e == null) {
+                    WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                            .createRenderQueue(tile, true);
+                    e = displayListCache.record(col, row, rq);
+                    twkUpdateContent(getPage(), rq,
+                            tile.getIntX() - 1, tile.getIntY() - 1,
+                            tile.getIntWidth() + 2, tile.getIntHeight() + 2);
+                    displayListCache.recorded(e);
+                }
+                currentFrame.addCachedRenderQueue(e);
+            }
+        }
+    }
+
     private void scroll(int x, int y, int w, int h, int dx, int dy) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("rect=[" + x + ", " + y + " " + w + "x" + h +
@@ -380,6 +478,11 @@ public final class WebPage {
         dx += currentFrame.scrollDx;
         dy += currentFrame.scrollDy;
 
+        // Recorded tiles are in viewport coordinates
+        if (displayListCache != null) {
+            displayListCache.clear();
+        }
+
         if (Math.abs(dx) < w && Math.abs(dy) < h) {
             int cx = (dx >= 0) ? x : x - dx;
             int cy = (dy >= 0) ? y : y - dy;
@@ -429,6 +532,10 @@ public final class WebPage {
     private static final class RenderFrame {
         private final List<WCRenderQueue> rqList =
                 new LinkedList<WCRenderQueue>();
+        // Queues owned by the display list cache, replayed rather than
+        // decoded and released rather than disposed
+        private final Map<WCRenderQueue, DisplayListCache.Entry> cachedRQs =
+                new IdentityHashMap<WCRenderQueue, DisplayListCache.Entry>();
         private int scrollDx, scrollDy;
         private final WCRectangle enclosingRect = new WCRectangle();
 
@@ -449,6 +556,28 @@ public final class WebPage {
             }
         }
 
+        // Called on: Event thread only
+        private void addCachedRenderQueue(DisplayListCache.Entry e) {
+            WCRenderQueue rq = e.getRenderQueue();
+            if (rq.isEmpty() || cachedRQs.containsKey(rq)) {
+                e.release();
+                return;
+            }
+            cachedRQs.put(rq, e);
+            addRenderQueue(rq);
+        }
+
+        // Called on: Main thread only
+        private void render(WCRenderQueue rq, WCGraphicsContext gc) {
+            DisplayListCache.Entry e = cachedRQs.get(rq);
+            if (e != null) {
+                rq.replay(gc);
+                e.release();
+            } else {
+                rq.decode(gc);
+            }
+        }
+
         // Called on: Event thread and Main thread
         private List<WCRenderQueue> getRQList() {
             return rqList;
@@ -462,9 +591,15 @@ public final class WebPage {
         // Called on: Event thread only
         private void drop() {
             for (WCRenderQueue rq : rqList) {
-                rq.dispose();
+                DisplayListCache.Entry e = cachedRQs.get(rq);
+                if (e != null) {
+                    e.release();
+                } else {
+                    rq.dispose();
+                }
             }
             rqList.clear();
+            cachedRQs.clear();
             enclosingRect.setFrame(0, 0, 0, 0);
             scrollDx = 0;
             scrollDy = 0;
@@ -693,6 +828,52 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Renders the {@code (x, y, w, h)} rectangle of the page into an
+     * offscreen surface at the given scale, without a scene, window or
+     * back buffer, and returns non-premultiplied RGBA pixels with
+     * {@code ceil(w * scale)} pixels per row. Lay the page out with
+     * {@link #setBounds} first. Blocks until the pixels are available.
+     * Returns {@code null} if the page is disposed or no offscreen surface
+     * can be created, for example because the graphics pipeline is gone.
+     */
+    public ByteBuffer renderToRGBA(final int x, final int y,
+                                   final int w, final int h, float scale)
+    {
+        if (w <= 0 || h <= 0 || !(scale > 0)) {
+            throw new IllegalArgumentException(
+                    "Invalid snapshot size: " + w + "x" + h + "@" + scale);
+        }
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.warning("renderToRGBA() called for a disposed web page.");
+                return null;
+            }
+            final WCRenderQueue rq = WCGraphicsManager.getGraphicsManager().
+                    createRenderQueue(new WCRectangle(x, y, w, h), true);
+            FutureTask<Void> f = new FutureTask<Void>(() -> {
+                twkUpdateContent(getPage(), rq, x, y, w, h);
+            }, null);
+            Invoker.getInvoker().invokeOnEventThread(f);
+
+            try {
+                // block until job is complete
+                f.get();
+            } catch (ExecutionException ex) {
+                throw new AssertionError(ex);
+            } catch (InterruptedException ex) {
+                rq.dispose();
+                return null;
+            }
+
+            return WCGraphicsManager.getGraphicsManager().
+                    renderOffscreen(rq, x, y, w, h, scale);
+        } finally {
+            unlockPage();
+        }
+    }
+
     /*
      * Executed on the Render Thread.
      */
@@ -703,7 +884,7 @@ public final class WebPage {
                 if (!backbuffer.validate(width, height)) {
                     // We need to repaint the whole page on the next turn
                     Invoker.getInvoker().invokeOnEventThread(() -> {
-                        repaintAll();
+                        restoreAll();
                     });
                     return;
                 }
@@ -742,7 +923,7 @@ public final class WebPage {
                 if (rq.getClip() != null) {
                     gc.setClip(rq.getClip());
                 }
-                rq.decode(gc);
+                frame.render(rq, gc);
                 gc.restoreState();
             }
         }
@@ -1020,6 +1201,9 @@ public final class WebPage {
 
             stop();
             dropRenderFrames();
+            if (displayListCache != null) {
+                displayListCache.clear();
+            }
             isDisposed = true;
 
             twkDestroyPage(pPage);
@@ -1886,6 +2070,176 @@ public final class WebPage {
         }
     }
 
+    /*
+     * Records the given pages into render queues in a single trip to the
+     * event thread, so that they can be drawn afterwards (and more than
+     * once, see WCRenderQueue.replay) without waiting on the event thread
+     * for every page. Must be called between beginPrinting and endPrinting.
+     * The caller owns the returned queues and must dispose them. If the
+     * calling thread is interrupted, no queues are returned.
+     */
+    public WCRenderQueue[] recordPrintPages(final int[] pageNumbers,
+                                            final float width)
+    {
+        return awaitPrintPages(recordPrintPagesLater(pageNumbers, width));
+    }
+
+    /*
+     * Waits for pages recorded by recordPrintPagesLater. If the calling
+     * thread is interrupted, the pages are released and none are returned.
+     */
+    public static WCRenderQueue[] awaitPrintPages(final Future<WCRenderQueue[]> f) {
+        try {
+            return f.get();
+        } catch (ExecutionException ex) {
+            throw new RuntimeException(ex.getCause());
+        } catch (InterruptedException ex) {
+            // The queues may still be in use on the event thread, so release
+            // them there once the recording is done
+            Invoker.getInvoker().postOnEventThread(() -> {
+                try {
+                    for (WCRenderQueue rq : f.get()) {
+                        rq.dispose();
+                    }
+                } catch (InterruptedException | ExecutionException e) {
+                    // nothing was recorded
+                }
+            });
+            Thread.currentThread().interrupt();
+            return new WCRenderQueue[0];
+        }
+    }
+
+    /*
+     * Like recordPrintPages, but returns as soon as the recording has been
+     * queued on the event thread. A printer running on another thread can
+     * so draw one batch of pages while the next one is being recorded. When
+     * called on the event thread, the pages are recorded before returning.
+     */
+    public Future<WCRenderQueue[]> recordPrintPagesLater(final int[] pageNumbers,
+                                                         final float width)
+    {
+        final WCGraphicsManager gm = WCGraphicsManager.getGraphicsManager();
+        final WCRenderQueue[] rqs = new WCRenderQueue[pageNumbers.length];
+        for (int i = 0; i < rqs.length; i++) {
+            rqs[i] = gm.createRenderQueue(null, true);
+        }
+        FutureTask<WCRenderQueue[]> f = new FutureTask<>(() -> {
+            lockPage();
+            try {
+                if (isDisposed) {
+                    log.warning("recordPrintPages() called for a disposed web page.");
+                    return rqs;
+                }
+                for (int i = 0; i < rqs.length; i++) {
+                    twkPrint(getPage(), rqs[i], pageNumbers[i], width);
+                }
+                return rqs;
+            } finally {
+                unlockPage();
+            }
+        });
+        Invoker.getInvoker().invokeOnEventThread(f);
+        return f;
+    }
+
+    // Maximum number of pages recorded ahead of the printer
+    private static final int PRINT_BATCH_SIZE = 16;
+
+    private static boolean printStatusOK(PrinterJob job) {
+        switch (job.getJobStatus()) {
+            case NOT_STARTED:
+            case PRINTING:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /*
+     * Prints the page with the given printer job, like WebEngine.print, and
+     * calls progress on the calling thread after each printed page with the
+     * number of pages printed so far and the number of pages to print.
+     * Pages are recorded on the event thread a batch at a time. When called
+     * on another thread, the next batch is recorded while the current one is
+     * being printed.
+     */
+    public void print(PrinterJob job, BiConsumer<Integer, Integer> progress) {
+        if (!printStatusOK(job)) {
+            return;
+        }
+
+        PageLayout pl = job.getJobSettings().getPageLayout();
+        float width = (float) pl.getPrintableWidth();
+        float height = (float) pl.getPrintableHeight();
+        int pageCount = beginPrinting(width, height);
+
+        List<Integer> pages = new ArrayList<>();
+        JobSettings jobSettings = job.getJobSettings();
+        if (jobSettings.getPageRanges() != null) {
+            PageRange[] pageRanges = jobSettings.getPageRanges();
+            for (PageRange p : pageRanges) {
+                for (int i = p.getStartPage(); i <= p.getEndPage() && i <= pageCount; ++i) {
+                    pages.add(i - 1);
+                }
+            }
+        } else {
+            for (int i = 0; i < pageCount; i++) {
+                pages.add(i);
+            }
+        }
+
+        // Pages are recorded on the event thread in batches, so that the
+        // printer does not wait on the event thread for every single page.
+        // The next batch is recorded while the current one is printed, so
+        // at most two batches are held at any time.
+        final int total = pages.size();
+        int printed = 0;
+        Future<WCRenderQueue[]> next = total > 0
+                ? recordPrintPagesLater(printBatch(pages, 0), width)
+                : null;
+        try {
+            for (int start = 0; next != null; start += PRINT_BATCH_SIZE) {
+                WCRenderQueue[] rqs = awaitPrintPages(next);
+                next = null;
+                int nextStart = start + PRINT_BATCH_SIZE;
+                if (nextStart < total && printStatusOK(job)
+                        && !Thread.currentThread().isInterrupted()) {
+                    next = recordPrintPagesLater(printBatch(pages, nextStart), width);
+                }
+                try {
+                    for (WCRenderQueue rq : rqs) {
+                        if (!printStatusOK(job)) {
+                            break;
+                        }
+                        job.printPage(new Printable(rq));
+                        printed++;
+                        if (progress != null) {
+                            progress.accept(printed, total);
+                        }
+                    }
+                } finally {
+                    for (WCRenderQueue rq : rqs) {
+                        rq.dispose();
+                    }
+                }
+            }
+        } finally {
+            if (next != null) {
+                for (WCRenderQueue rq : awaitPrintPages(next)) {
+                    rq.dispose();
+                }
+            }
+            endPrinting();
+        }
+    }
+
+    private static int[] printBatch(List<Integer> pages, int start) {
+        int[] batch = new int[Math.min(PRINT_BATCH_SIZE, pages.size() - start)];
+        for (int i = 0; i < batch.length; i++) {
+            batch[i] = pages.get(start + i);
+        }
+
     public int getPageHeight() {
         return getFrameHeight(getMainFrame());
     }
@@ -2060,6 +2414,481 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory where IndexedDB databases are persisted.
+     * The IndexedDB server is shared by all pages of the default session,
+     * so only the first directory applied takes effect; until then
+     * databases are kept in memory only.
+     *
+     * @return whether databases are now persisted under {@code path};
+     *         {@code false} if another directory was applied first or
+     *         IndexedDB was already used without one
+     */
+    public boolean setIndexedDatabasePath(String path) {
+        lockPage();
+        try {
+            return twkSetIndexedDatabasePath(getPage(), path);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Sets the per-origin IndexedDB quota in bytes. Transactions that
+     * would grow an origin's databases beyond the quota fail with
+     * a {@code QuotaExceededError}. Must be set before the first
+     * IndexedDB access to take effect.
+     */
+    public static void setIndexedDatabaseQuota(long quota) {
+        if (quota <= 0) {
+            throw new IllegalArgumentException("quota: " + quota);
+        }
+        lockPage();
+        try {
+            twkSetIndexedDatabaseQuota(quota);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the total size in bytes of the IndexedDB databases
+     * persisted on disk, or 0 if IndexedDB is memory-only.
+     */
+    public long getIndexedDatabaseUsage() {
+        lockPage();
+        try {
+            return twkGetIndexedDatabaseUsage();
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // ---- BYTECODE CACHE SUPPORT ---- //
+
+    private static final boolean useBytecodeCache;
+    private static final boolean useWarmUpProfile;
+    static {
+        @SuppressWarnings("removal")
+        boolean value = AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                Boolean.valueOf(System.getProperty("com.sun.webkit.useBytecodeCache", "false")));
+        useBytecodeCache = value;
+        @SuppressWarnings("removal")
+        boolean warmUp = AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                Boolean.valueOf(System.getProperty("com.sun.webkit.useWarmUpProfile", "true")));
+        useWarmUpProfile = warmUp;
+    }
+
+    /**
+     * Returns whether the on-disk JavaScript bytecode cache has been
+     * requested with the {@code com.sun.webkit.useBytecodeCache} property.
+     */
+    public static boolean isBytecodeCacheRequested() {
+        return useBytecodeCache;
+    }
+
+    /**
+     * Returns whether JIT warm-up profiles should be kept with the bytecode
+     * cache. They are on by default and can be turned off with the
+     * {@code com.sun.webkit.useWarmUpProfile} property.
+     */
+    public static boolean isWarmUpProfileRequested() {
+        return useWarmUpProfile;
+    }
+
+    /**
+     * Enables or disables the JIT warm-up profiles stored next to the
+     * bytecode cache entries. A profile records the highest JIT tier each
+     * function of a script reached, and functions that got there before
+     * are compiled sooner the next time the script runs.
+     */
+    public static void setWarmUpProfileEnabled(boolean enabled) {
+        lockPage();
+        try {
+            twkSetWarmUpProfileEnabled(enabled);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Sets the directory where bytecode generated for page scripts is
+     * cached between launches. The cache is shared by all pages, so,
+     * like the IndexedDB directory, only the first directory applied
+     * takes effect; until then the cache is disabled.
+     *
+     * @return whether bytecode is now cached under {@code path}
+     */
+    public static boolean setBytecodeCachePath(String path) {
+        lockPage();
+        try {
+            return twkSetBytecodeCachePath(path);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Snapshot of the bytecode cache counters accumulated by this process.
+     */
+    public static final class BytecodeCacheStatistics {
+        private final long hits;
+        private final long misses;
+        private final long stores;
+        private final long bytesLoaded;
+        private final long bytesStored;
+        private final long savedGenerationMicros;
+        private final long warmUpProfilesLoaded;
+        private final long warmUpProfilesStored;
+        private final long warmUpHints;
+        private final long warmUpTierUps;
+        private final long coldScripts;
+        private final long coldSteadyStateMicros;
+        private final long warmScripts;
+        private final long warmSteadyStateMicros;
+
+        private BytecodeCacheStatistics(long[] values) {
+            hits = values[0];
+            misses = values[1];
+            stores = values[2];
+            bytesLoaded = values[3];
+            bytesStored = values[4];
+            savedGenerationMicros = values[5];
+            warmUpProfilesLoaded = values[6];
+            warmUpProfilesStored = values[7];
+            warmUpHints = values[8];
+            warmUpTierUps = values[9];
+            coldScripts = values[10];
+            coldSteadyStateMicros = values[11];
+            warmScripts = values[12];
+            warmSteadyStateMicros = values[13];
+        }
+
+        public long getHits() { return hits; }
+        public long getMisses() { return misses; }
+        public long getStores() { return stores; }
+        public long getBytesLoaded() { return bytesLoaded; }
+        public long getBytesStored() { return bytesStored; }
+
+        /**
+         * Returns the parse and bytecode generation time, in microseconds,
+         * that cache hits saved, as measured when the entries were created.
+         */
+        public long getSavedGenerationMicros() { return savedGenerationMicros; }
+
+        public long getWarmUpProfilesLoaded() { return warmUpProfilesLoaded; }
+        public long getWarmUpProfilesStored() { return warmUpProfilesStored; }
+
+        /**
+         * Returns how many functions were compiled early because a loaded
+         * warm-up profile showed they got hot in an earlier run.
+         */
+        public long getWarmUpHints() { return warmUpHints; }
+        public long getWarmUpTierUps() { return warmUpTierUps; }
+
+        /**
+         * Returns the average time, in microseconds, from a script's first
+         * function call to its last JIT tier-up, for scripts that ran
+         * without a warm-up profile.
+         */
+        public long getColdTimeToSteadyStateMicros() {
+            return coldScripts == 0 ? 0 : coldSteadyStateMicros / coldScripts;
+        }
+
+        /**
+         * Returns the same average as {@link #getColdTimeToSteadyStateMicros}
+         * for scripts that ran with a warm-up profile.
+         */
+        public long getWarmTimeToSteadyStateMicros() {
+            return warmScripts == 0 ? 0 : warmSteadyStateMicros / warmScripts;
+        }
+
+        public double getHitRate() {
+            long lookups = hits + misses;
+            return lookups == 0 ? 0.0 : (double) hits / lookups;
+        }
+
+        @Override
+        public String toString() {
+            return String.format("BytecodeCacheStatistics[hits=%d, misses=%d, stores=%d, "
+                    + "bytesLoaded=%d, bytesStored=%d, savedGenerationMicros=%d, "
+                    + "warmUpProfilesLoaded=%d, warmUpProfilesStored=%d, "
+                    + "warmUpHints=%d, warmUpTierUps=%d, "
+                    + "coldTimeToSteadyStateMicros=%d, warmTimeToSteadyStateMicros=%d]",
+                    hits, misses, stores, bytesLoaded, bytesStored,
+                    savedGenerationMicros, warmUpProfilesLoaded,
+                    warmUpProfilesStored, warmUpHints, warmUpTierUps,
+                    getColdTimeToSteadyStateMicros(),
+                    getWarmTimeToSteadyStateMicros());
+        }
+    }
+
+    public static BytecodeCacheStatistics getBytecodeCacheStatistics() {
+        lockPage();
+        try {
+            return new BytecodeCacheStatistics(twkGetBytecodeCacheStatistics());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Snapshot of the local storage counters accumulated by this process.
+     */
+    public static final class LocalStorageStatistics {
+        private final long imports;
+        private final long importedItems;
+        private final long importMicros;
+        private final long lookupsDuringImport;
+        private final long syncs;
+        private final long syncedItems;
+        private final long largestSync;
+        private final long deferredItems;
+
+        private LocalStorageStatistics(long[] values) {
+            imports = values[0];
+            importedItems = values[1];
+            importMicros = values[2];
+            lookupsDuringImport = values[3];
+            syncs = values[4];
+            syncedItems = values[5];
+            largestSync = values[6];
+            deferredItems = values[7];
+        }
+
+        public long getImports() { return imports; }
+        public long getImportedItems() { return importedItems; }
+
+        /**
+         * Returns the total time, in microseconds, from the creation of each
+         * storage area to the end of its import from disk.
+         */
+        public long getImportMicros() { return importMicros; }
+
+        /**
+         * Returns how many {@code getItem} calls were answered before the
+         * import of their storage area completed.
+         */
+        public long getLookupsDuringImport() { return lookupsDuringImport; }
+        public long getSyncs() { return syncs; }
+        public long getSyncedItems() { return syncedItems; }
+
+        /** Returns the largest number of items written by a single sync. */
+        public long getLargestSync() { return largestSync; }
+
+        /**
+         * Returns how many changed items were left for a later sync because
+         * the batch of their sync was full.
+         */
+        public long getDeferredItems() { return deferredItems; }
+
+        @Override
+        public String toString() {
+            return String.format("LocalStorageStatistics[imports=%d, importedItems=%d, "
+                    + "importMicros=%d, lookupsDuringImport=%d, syncs=%d, "
+                    + "syncedItems=%d, largestSync=%d, deferredItems=%d]",
+                    imports, importedItems, importMicros, lookupsDuringImport,
+                    syncs, syncedItems, largestSync, deferredItems);
+        }
+    }
+
+    public static LocalStorageStatistics getLocalStorageStatistics() {
+        lockPage();
+        try {
+            return new LocalStorageStatistics(twkGetLocalStorageStatistics());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // ---- MEMORY PRESSURE SUPPORT ---- //
+
+    /**
+     * Memory pressure level that drops dead cache entries and decoded data
+     * WebCore can cheaply recreate.
+     */
+    public static final int MEMORY_PRESSURE_MODERATE = 1;
+
+    /**
+     * Memory pressure level that also empties the back-forward cache, the
+     * font cache and the memory cache, and runs a full JavaScript GC.
+     */
+    public static final int MEMORY_PRESSURE_CRITICAL = 2;
+
+    // Fractions of the maximum Java heap that, when still in use after a JVM
+    // GC cycle, make WebCore release memory at the corresponding level.
+    private static final double moderateHeapPressure;
+    private static final double criticalHeapPressure;
+    static {
+        @SuppressWarnings("removal")
+        double[] values = AccessController.doPrivileged((PrivilegedAction<double[]>) () -> new double[] {
+                Double.parseDouble(System.getProperty("com.sun.webkit.moderateHeapPressure", "0.75")),
+                Double.parseDouble(System.getProperty("com.sun.webkit.criticalHeapPressure", "0.9"))
+        });
+        moderateHeapPressure = values[0];
+        criticalHeapPressure = values[1];
+    }
+
+    private static int heapPressureLevel = 0;
+    private static volatile Consumer<MemoryStatistics> memoryStatisticsListener;
+
+    /**
+     * Asks WebCore to release cached memory at the given level. May be
+     * called on any thread; the work is done on the event thread.
+     *
+     * @throws IllegalArgumentException if {@code level} is neither
+     *         {@link #MEMORY_PRESSURE_MODERATE} nor {@link #MEMORY_PRESSURE_CRITICAL}
+     */
+    public static void releaseMemory(int level) {
+        if (level != MEMORY_PRESSURE_MODERATE && level != MEMORY_PRESSURE_CRITICAL) {
+            throw new IllegalArgumentException("Invalid memory pressure level: " + level);
+        }
+        Invoker.getInvoker().invokeOnEventThread(() -> {
+            DisplayListCache.clearAll();
+            twkReleaseMemory(level == MEMORY_PRESSURE_CRITICAL);
+        });
+    }
+
+    /**
+     * Sets a listener that receives a {@link MemoryStatistics} snapshot on
+     * the event thread after every JVM GC cycle observed by the web engine.
+     * {@code null} removes the listener.
+     */
+    public static void setMemoryStatisticsListener(Consumer<MemoryStatistics> listener) {
+        memoryStatisticsListener = listener;
+    }
+
+    /**
+     * Called on the event thread once a JVM GC cycle has completed, which is
+     * when the used heap best reflects live data.
+     */
+    private static void checkHeapPressure() {
+        Runtime runtime = Runtime.getRuntime();
+        long maxMemory = runtime.maxMemory();
+        if (maxMemory != Long.MAX_VALUE) {
+            double usage = (double) (runtime.totalMemory() - runtime.freeMemory()) / maxMemory;
+            int level = usage >= criticalHeapPressure ? MEMORY_PRESSURE_CRITICAL
+                    : usage >= moderateHeapPressure ? MEMORY_PRESSURE_MODERATE : 0;
+            // Release on every cycle spent at the critical level, since the
+            // caches refill as pages keep loading, but only once per rise to
+            // the moderate level.
+            if (level > heapPressureLevel || level == MEMORY_PRESSURE_CRITICAL) {
+                if (log.isLoggable(Level.FINE)) {
+                    log.fine(String.format("Java heap %.0f%% used, releasing memory at level %d",
+                            usage * 100, level));
+                }
+                DisplayListCache.clearAll();
+                twkReleaseMemory(level == MEMORY_PRESSURE_CRITICAL);
+            }
+            heapPressureLevel = level;
+        }
+
+        Consumer<MemoryStatistics> listener = memoryStatisticsListener;
+        if (listener != null || log.isLoggable(Level.FINER)) {
+            MemoryStatistics statistics = new MemoryStatistics(twkGetMemoryStatistics());
+            log.finer("Memory statistics after JVM GC: {0}", statistics);
+            if (listener != null) {
+                listener.accept(statistics);
+            }
+        }
+    }
+
+    /**
+     * Snapshot of the sizes of the main WebCore and JavaScriptCore caches.
+     */
+    public static final class MemoryStatistics {
+        private final long memoryCacheSize;
+        private final long decodedImageSize;
+        private final long backForwardCachePageCount;
+        private final long jsHeapSize;
+        private final long jsHeapExtraMemorySize;
+        private final long fontCount;
+        private final long inactiveFontCount;
+
+        private MemoryStatistics(long[] values) {
+            memoryCacheSize = values[0];
+            decodedImageSize = values[1];
+            backForwardCachePageCount = values[2];
+            jsHeapSize = values[3];
+            jsHeapExtraMemorySize = values[4];
+            fontCount = values[5];
+            inactiveFontCount = values[6];
+        }
+
+        /** Returns the bytes held by resources in the memory cache. */
+        public long getMemoryCacheSize() { return memoryCacheSize; }
+
+        /** Returns the bytes of decoded image data held by the memory cache. */
+        public long getDecodedImageSize() { return decodedImageSize; }
+        public long getBackForwardCachePageCount() { return backForwardCachePageCount; }
+        public long getJSHeapSize() { return jsHeapSize; }
+
+        /** Returns the non-GC memory referenced by JavaScript objects, in bytes. */
+        public long getJSHeapExtraMemorySize() { return jsHeapExtraMemorySize; }
+        public long getFontCount() { return fontCount; }
+        public long getInactiveFontCount() { return inactiveFontCount; }
+
+        @Override
+        public String toString() {
+            return String.format("MemoryStatistics[memoryCacheSize=%d, decodedImageSize=%d, "
+                    + "backForwardCachePageCount=%d, jsHeapSize=%d, jsHeapExtraMemorySize=%d, "
+                    + "fontCount=%d, inactiveFontCount=%d]",
+                    memoryCacheSize, decodedImageSize, backForwardCachePageCount,
+                    jsHeapSize, jsHeapExtraMemorySize, fontCount, inactiveFontCount);
+        }
+    }
+
+    public static MemoryStatistics getMemoryStatistics() {
+        lockPage();
+        try {
+            return new MemoryStatistics(twkGetMemoryStatistics());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // ---- SAMPLING PROFILER SUPPORT ---- //
+
+    /**
+     * Starts sampling the JavaScript stacks of all pages about every
+     * {@code intervalMicros} microseconds. Samples left from a run that was
+     * not stopped are discarded. Must be called on the event thread.
+     *
+     * @return false if the sampling profiler is not available on this
+     *         platform
+     * @throws IllegalArgumentException if {@code intervalMicros} is not
+     *         positive
+     */
+    public static boolean startSamplingProfiler(int intervalMicros) {
+        if (intervalMicros <= 0) {
+            throw new IllegalArgumentException("Invalid sampling interval: " + intervalMicros);
+        }
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            log.fine("Starting sampling profiler, interval = {0}us", intervalMicros);
+            return twkStartSamplingProfiler(intervalMicros);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Stops the sampling profiler and returns the samples taken since it was
+     * started, or null if it was never started. Must be called on the event
+     * thread.
+     */
+    public static ScriptProfile stopSamplingProfiler() {
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            byte[] data = twkStopSamplingProfiler();
+            return data != null ? new ScriptProfile(data) : null;
+        } finally {
+            unlockPage();
+        }
+    }
+
     // ---- INSPECTOR SUPPORT ---- //
 
     public void connectInspectorFrontend() {
@@ -2124,7 +2953,11 @@ public final class WebPage {
                 paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
                         new Object[] {x, y, w, h});
             }
-            addDirtyRect(new WCRectangle(x, y, w, h));
+            WCRectangle r = new WCRectangle(x, y, w, h);
+            if (displayListCache != null) {
+                displayListCache.invalidate(r);
+            }
+            addDirtyRect(r);
         } finally {
             unlockPage();
         }
@@ -2502,6 +3335,7 @@ public final class WebPage {
     }
 
     private static native int twkWorkerThreadCount();
+    private static native boolean twkIsFTLJITEnabled();
 
     private void fwkDidClearWindowObject(long pContext, long pWindowObject) {
         if (pageClient != null) {
@@ -2539,6 +3373,15 @@ public final class WebPage {
     }
 
     private void repaintAll() {
+        if (displayListCache != null) {
+            displayListCache.clear();
+        }
+        restoreAll();
+    }
+
+    // Repaints the entire page when its content has not changed but what
+    // has been painted is lost, so recorded tiles may be replayed
+    private void restoreAll() {
         dirtyRects.clear();
         addDirtyRect(new WCRectangle(0, 0, width, height));
     }
@@ -2548,11 +3391,44 @@ public final class WebPage {
         return frames.size();
     }
 
+    // Package scope method for testing, acts as if the painted page was lost
+    void test_restoreAll() {
+        lockPage();
+        try {
+            restoreAll();
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // Package scope method for testing, overrides com.sun.webkit.useDisplayListCache
+    // for this page. The whole page is repainted on the next update.
+    void test_setDisplayListCacheEnabled(boolean enabled) {
+        lockPage();
+        try {
+            if (enabled == (displayListCache != null)) {
+                return;
+            }
+            if (displayListCache != null) {
+                displayListCache.clear();
+            }
+            displayListCache = enabled ? new DisplayListCache() : null;
+            restoreAll();
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // Package scope method for testing, valid once a page has been created
+    static boolean test_isFTLJITEnabled() {
+        return twkIsFTLJITEnabled();
+    }
+
     // *************************************************************************
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useFTLJIT, boolean useCSS3D);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2674,6 +3550,17 @@ public final class WebPage {
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
+    private native boolean twkSetIndexedDatabasePath(long page, String path);
+    private static native void twkSetIndexedDatabaseQuota(long quota);
+    private static native long twkGetIndexedDatabaseUsage();
+    private static native boolean twkSetBytecodeCachePath(String path);
+    private static native void twkSetWarmUpProfileEnabled(boolean enabled);
+    private static native long[] twkGetBytecodeCacheStatistics();
+    private static native long[] twkGetLocalStorageStatistics();
+    private static native void twkReleaseMemory(boolean critical);
+    private static native long[] twkGetMemoryStatistics();
+    private static native boolean twkStartSamplingProfiler(int intervalMicros);
+    private static native byte[] twkStopSamplingProfiler();
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
 
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.dom;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import netscape.javascript.JSException;
+
+/**
+ * Exchanges structured values with scripts in a single native call instead
+ * of converting them one member at a time.
+ *
+ * <p>Java values map to script values as follows:
+ * <ul>
+ * <li>{@code null} to {@code null}
+ * <li>{@code Boolean}, {@code Number}, {@code Character} and
+ *     {@code CharSequence} to booleans, numbers and strings
+ * <li>{@code byte[]}, {@code short[]}, {@code int[]}, {@code long[]},
+ *     {@code float[]} and {@code double[]} to {@code Int8Array},
+ *     {@code Int16Array}, {@code Int32Array}, {@code BigInt64Array},
+ *     {@code Float32Array} and {@code Float64Array}
+ * <li>{@code ByteBuffer} to an {@code ArrayBuffer} holding the remaining
+ *     bytes
+ * <li>{@code Object[]} and {@code Collection} to arrays
+ * <li>{@code Map} with string keys to plain objects
+ * </ul>
+ *
+ * <p>Script values come back as {@code null}, {@code Boolean},
+ * {@code Integer} or {@code Double}, {@code String}, {@code List},
+ * {@code Map} or {@code ByteBuffer}, and typed arrays as primitive arrays
+ * of the same element size. Unsigned typed arrays keep their bit patterns.
+ * {@code undefined}, functions and symbols come back as {@code null}.
+ *
+ * <p>Binary data is always copied. Direct buffers are copied straight into
+ * the new {@code ArrayBuffer} without passing through the encoded form.
+ * All methods must be called on the event thread.
+ *
+ * <p>This class is internal to javafx.web and its package is not exported.
+ * It is not part of the supported API, and the value mapping may change
+ * with the wire format in JSDataCodec.h.
+ */
+public final class JSData {
+    private static final int VERSION = 1;
+    private static final int MAX_DEPTH = 512;
+
+    // Keep in sync with JSDataCodec.h
+    private static final byte TAG_UNDEFINED = 0;
+    private static final byte TAG_NULL = 1;
+    private static final byte TAG_FALSE = 2;
+    private static final byte TAG_TRUE = 3;
+    private static final byte TAG_INT32 = 4;
+    private static final byte TAG_DOUBLE = 5;
+    private static final byte TAG_STRING = 6;
+    private static final byte TAG_ARRAY = 7;
+    private static final byte TAG_OBJECT = 8;
+    private static final byte TAG_ARRAY_BUFFER = 9;
+    private static final byte TAG_TYPED_ARRAY = 10;
+    private static final byte TAG_DIRECT_BUFFER = 11;
+
+    private static final byte KIND_INT8 = 0;
+    private static final byte KIND_UINT8 = 1;
+    private static final byte KIND_UINT8_CLAMPED = 2;
+    private static final byte KIND_INT16 = 3;
+    private static final byte KIND_UINT16 = 4;
+    private static final byte KIND_INT32 = 5;
+    private static final byte KIND_UINT32 = 6;
+    private static final byte KIND_FLOAT32 = 7;
+    private static final byte KIND_FLOAT64 = 8;
+    private static final byte KIND_BIGINT64 = 9;
+    private static final byte KIND_BIGUINT64 = 10;
+
+    private JSData() {
+    }
+
+    /**
+     * Sets a member of {@code target} to the script counterpart of
+     * {@code value}.
+     *
+     * @throws IllegalArgumentException if {@code target} is not a WebKit
+     *         script object or {@code value} cannot be converted
+     */
+    public static void setMember(netscape.javascript.JSObject target,
+                                 String name, Object value) throws JSException {
+        Encoder encoder = new Encoder();
+        encoder.encode(value, 0);
+        peer(target).setMemberData(name, encoder.toByteArray(),
+                                   encoder.getDirectBuffers());
+    }
+
+    /**
+     * Returns the Java counterpart of a member of {@code target}.
+     *
+     * @throws IllegalArgumentException if {@code target} is not a WebKit
+     *         script object
+     * @throws JSException if a getter throws or the member is nested too
+     *         deeply, which includes cyclic structures
+     */
+    public static Object getMember(netscape.javascript.JSObject target,
+                                   String name) throws JSException {
+        return new Decoder(peer(target).getMemberData(name)).decode();
+    }
+
+    /**
+     * Calls a method of {@code target} with the script counterparts of
+     * {@code args} and returns the Java counterpart of the result.
+     *
+     * @throws IllegalArgumentException if {@code target} is not a WebKit
+     *         script object or an argument cannot be converted
+     */
+    public static Object call(netscape.javascript.JSObject target,
+                              String methodName, Object... args) throws JSException {
+        Encoder encoder = new Encoder();
+        encoder.encode(args != null ? args : new Object[0], 0);
+        byte[] result = peer(target).callData(methodName, encoder.toByteArray(),
+                                              encoder.getDirectBuffers());
+        return new Decoder(result).decode();
+    }
+
+    private static JSObject peer(netscape.javascript.JSObject target) {
+        if (!(target instanceof JSObject)) {
+            throw new IllegalArgumentException("Not a WebKit script object: " + target);
+        }
+        return (JSObject) target;
+    }
+
+    private static final class Encoder {
+        private ByteBuffer buffer = ByteBuffer.allocate(256).order(ByteOrder.nativeOrder());
+        private final List<ByteBuffer> directBuffers = new ArrayList<>();
+
+        private Encoder() {
+            buffer.putInt(VERSION);
+        }
+
+        private byte[] toByteArray() {
+            return Arrays.copyOf(buffer.array(), buffer.position());
+        }
+
+        private ByteBuffer[] getDirectBuffers() {
+            return directBuffers.isEmpty()
+                    ? null : directBuffers.toArray(new ByteBuffer[0]);
+        }
+
+        private void reserve(long size) {
+            if (buffer.remaining() >= size) {
+                return;
+            }
+            long capacity = Math.max(2L * buffer.capacity(), buffer.position() + size);
+            if (capacity > Integer.MAX_VALUE - 8) {
+                throw new IllegalArgumentException("Value is too large");
+            }
+            ByteBuffer grown = ByteBuffer.allocate((int) capacity).order(ByteOrder.nativeOrder());
+            buffer.flip();
+            grown.put(buffer);
+            buffer = grown;
+        }
+
+        private void putTag(byte tag) {
+            reserve(1);
+            buffer.put(tag);
+        }
+
+        private void putString(String s) {
+            reserve(4 + 2L * s.length());
+            buffer.putInt(s.length());
+            buffer.asCharBuffer().put(s);
+            buffer.position(buffer.position() + 2 * s.length());
+        }
+
+        private void putTypedArrayHeader(byte kind, int length, int elementSize) {
+            reserve(6 + (long) length * elementSize);
+            buffer.put(TAG_TYPED_ARRAY);
+            buffer.put(kind);
+            buffer.putInt(length);
+        }
+
+        private void encode(Object value, int depth) {
+            if (depth > MAX_DEPTH) {
+                throw new IllegalArgumentException("Value is nested too deeply or cyclic");
+            }
+            if (value == null) {
+                putTag(TAG_NULL);
+            } else if (value instanceof Boolean) {
+                putTag((Boolean) value ? TAG_TRUE : TAG_FALSE);
+            } else if (value instanceof Integer || value instanceof Short
+                    || value instanceof Byte) {
+                reserve(5);
+                buffer.put(TAG_INT32);
+                buffer.putInt(((Number) value).intValue());
+            } else if (value instanceof Number) {
+                reserve(9);
+                buffer.put(TAG_DOUBLE);
+                buffer.putDouble(((Number) value).doubleValue());
+            } else if (value instanceof CharSequence || value instanceof Character) {
+                putTag(TAG_STRING);
+                putString(value.toString());
+            } else if (value instanceof byte[]) {
+                byte[] array = (byte[]) value;
+                putTypedArrayHeader(KIND_INT8, array.length, 1);
+                buffer.put(array);
+            } else if (value instanceof short[]) {
+                short[] array = (short[]) value;
+                putTypedArrayHeader(KIND_INT16, array.length, 2);
+                buffer.asShortBuffer().put(array);
+                buffer.position(buffer.position() + 2 * array.length);
+            } else if (value instanceof int[]) {
+                int[] array = (int[]) value;
+                putTypedArrayHeader(KIND_INT32, array.length, 4);
+                buffer.asIntBuffer().put(array);
+                buffer.position(buffer.position() + 4 * array.length);
+            } else if (value instanceof long[]) {
+                long[] array = (long[]) value;
+                putTypedArrayHeader(KIND_BIGINT64, array.length, 8);
+                buffer.asLongBuffer().put(array);
+                buffer.position(buffer.position() + 8 * array.length);
+            } else if (value instanceof float[]) {
+                float[] array = (float[]) value;
+                putTypedArrayHeader(KIND_FLOAT32, array.length, 4);
+                buffer.asFloatBuffer().put(array);
+                buffer.position(buffer.position() + 4 * array.length);
+            } else if (value instanceof double[]) {
+                double[] array = (double[]) value;
+                putTypedArrayHeader(KIND_FLOAT64, array.length, 8);
+                buffer.asDoubleBuffer().put(array);
+                buffer.position(buffer.position() + 8 * array.length);
+            } else if (value instanceof ByteBuffer) {
+                ByteBuffer bytes = (ByteBuffer) value;
+                if (bytes.isDirect()) {
+                    reserve(13);
+                    buffer.put(TAG_DIRECT_BUFFER);
+                    buffer.putInt(directBuffers.size());
+                    buffer.putInt(bytes.position());
+                    buffer.putInt(bytes.remaining());
+                    directBuffers.add(bytes);
+                } else {
+                    reserve(5 + bytes.remaining());
+                    buffer.put(TAG_ARRAY_BUFFER);
+                    buffer.putInt(bytes.remaining());
+                    buffer.put(bytes.duplicate());
+                }
+            } else if (value instanceof Object[]) {
+                Object[] array = (Object[]) value;
+                reserve(5);
+                buffer.put(TAG_ARRAY);
+                buffer.putInt(array.length);
+                for (Object element : array) {
+                    encode(element, depth + 1);
+                }
+            } else if (value instanceof Collection) {
+                Collection<?> collection = (Collection<?>) value;
+                reserve(5);
+                buffer.put(TAG_ARRAY);
+                buffer.putInt(collection.size());
+                for (Object element : collection) {
+                    encode(element, depth + 1);
+                }
+            } else if (value instanceof Map) {
+                Map<?, ?> map = (Map<?, ?>) value;
+                reserve(5);
+                buffer.put(TAG_OBJECT);
+                buffer.putInt(map.size());
+                for (Map.Entry<?, ?> entry : map.entrySet()) {
+                    if (!(entry.getKey() instanceof CharSequence)) {
+                        throw new IllegalArgumentException("Unsupported key: " + entry.getKey());
+                    }
+                    putString(entry.getKey().toString());
+                    encode(entry.getValue(), depth + 1);
+                }
+            } else {
+                throw new IllegalArgumentException(
+                        "Unsupported value type: " + value.getClass().getName());
+            }
+        }
+    }
+
+    private static final class Decoder {
+        private final ByteBuffer buffer;
+
+        private Decoder(byte[] data) {
+            buffer = ByteBuffer.wrap(data).order(ByteOrder.nativeOrder());
+            int version = buffer.getInt();
+            if (version != VERSION) {
+                throw new IllegalStateException("Unsupported JSData version " + version);
+            }
+        }
+
+        private String getString() {
+            char[] chars = new char[buffer.getInt()];
+            buffer.asCharBuffer().get(chars);
+            buffer.position(buffer.position() + 2 * chars.length);
+            return new String(chars);
+        }
+
+        private Object decode() {
+            byte tag = buffer.get();
+            switch (tag) {
+                case TAG_UNDEFINED:
+                case TAG_NULL:
+                    return null;
+                case TAG_FALSE:
+                    return Boolean.FALSE;
+                case TAG_TRUE:
+                    return Boolean.TRUE;
+                case TAG_INT32:
+                    return buffer.getInt();
+                case TAG_DOUBLE:
+                    return buffer.getDouble();
+                case TAG_STRING:
+                    return getString();
+                case TAG_ARRAY: {
+                    int count = buffer.getInt();
+                    List<Object> list = new ArrayList<>(count);
+                    for (int i = 0; i < count; i++) {
+                        list.add(decode());
+                    }
+                    return list;
+                }
+                case TAG_OBJECT: {
+                    int count = buffer.getInt();
+                    Map<String, Object> map = new LinkedHashMap<>();
+                    for (int i = 0; i < count; i++) {
+                        String key = getString();
+                        map.put(key, decode());
+                    }
+                    return map;
+                }
+                case TAG_ARRAY_BUFFER: {
+                    // The encoded array is private to this call, so the
+                    // buffer can share it instead of copying the bytes.
+                    int length = buffer.getInt();
+                    ByteBuffer bytes = buffer.duplicate();
+                    bytes.limit(bytes.position() + length);
+                    buffer.position(buffer.position() + length);
+                    return bytes.slice().order(ByteOrder.nativeOrder());
+                }
+                case TAG_TYPED_ARRAY:
+                    return decodeTypedArray(buffer.get(), buffer.getInt());
+                default:
+                    throw new IllegalStateException("Malformed JSData buffer");
+            }
+        }
+
+        private Object decodeTypedArray(byte kind, int length) {
+            switch (kind) {
+                case KIND_INT8:
+                case KIND_UINT8:
+                case KIND_UINT8_CLAMPED: {
+                    byte[] array = new byte[length];
+                    buffer.get(array);
+                    return array;
+                }
+                case KIND_INT16:
+                case KIND_UINT16: {
+                    short[] array = new short[length];
+                    buffer.asShortBuffer().get(array);
+                    buffer.position(buffer.position() + 2 * length);
+                    return array;
+                }
+                case KIND_INT32:
+                case KIND_UINT32: {
+                    int[] array = new int[length];
+                    buffer.asIntBuffer().get(array);
+                    buffer.position(buffer.position() + 4 * length);
+                    return array;
+                }
+                case KIND_FLOAT32: {
+                    float[] array = new float[length];
+                    buffer.asFloatBuffer().get(array);
+                    buffer.position(buffer.position() + 4 * length);
+                    return array;
+                }
+                case KIND_FLOAT64: {
+                    double[] array = new double[length];
+                    buffer.asDoubleBuffer().get(array);
+                    buffer.position(buffer.position() + 8 * length);
+                    return array;
+                }
+                case KIND_BIGINT64:
+                case KIND_BIGUINT64: {
+                    long[] array = new long[length];
+                    buffer.asLongBuffer().get(array);
+                    buffer.position(buffer.position() + 8 * length);
+                    return array;
+                }
+                default:
+                    throw new IllegalStateException("Malformed JSData buffer");
+            }
+        }
+    }
+}
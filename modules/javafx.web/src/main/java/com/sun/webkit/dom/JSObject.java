@@ -28,6 +28,7 @@ package com.sun.webkit.dom;
 import com.sun.webkit.Disposer;
 import com.sun.webkit.DisposerRecord;
 import com.sun.webkit.Invoker;
+import java.nio.ByteBuffer;
 import java.security.AccessControlContext;
 import java.security.AccessController;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -133,6 +134,30 @@ class JSObject extends netscape.javascript.JSObject {
                                           String methodName, Object[] args,
                                           @SuppressWarnings("removal") AccessControlContext acc);
 
+    // Bulk transfer of values encoded by JSData
+    void setMemberData(String name, byte[] data, ByteBuffer[] buffers) {
+        Invoker.getInvoker().checkEventThread();
+        setMemberDataImpl(peer, peer_type, name, data, buffers);
+    }
+    private static native void setMemberDataImpl(long peer, int peer_type,
+                                                 String name, byte[] data,
+                                                 ByteBuffer[] buffers);
+
+    byte[] getMemberData(String name) {
+        Invoker.getInvoker().checkEventThread();
+        return getMemberDataImpl(peer, peer_type, name);
+    }
+    private static native byte[] getMemberDataImpl(long peer, int peer_type,
+                                                   String name);
+
+    byte[] callData(String methodName, byte[] args, ByteBuffer[] buffers) {
+        Invoker.getInvoker().checkEventThread();
+        return callDataImpl(peer, peer_type, methodName, args, buffers);
+    }
+    private static native byte[] callDataImpl(long peer, int peer_type,
+                                              String methodName, byte[] args,
+                                              ByteBuffer[] buffers);
+
     @Override
     public String toString() {
         Invoker.getInvoker().checkEventThread();
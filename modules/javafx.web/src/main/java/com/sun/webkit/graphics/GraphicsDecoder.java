@@ -210,7 +210,9 @@ public final class GraphicsDecoder  {
                     drawPattern(gc,
                         gm.getRef(buf.getInt()),
                         getRectangle(buf),
-                        (WCTransform)gm.getRef(buf.getInt()),
+                        new WCTransform(
+                            buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                            buf.getFloat(), buf.getFloat(), buf.getFloat()),
                         getPoint(buf),
                         getRectangle(buf));
                     break;
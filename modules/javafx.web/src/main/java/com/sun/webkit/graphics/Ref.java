@@ -51,6 +51,19 @@ public class Ref {
         }
     }
 
+    // Called from native code: references the object and returns its ID
+    private int fwkRef() {
+        ref();
+        return id;
+    }
+
+    // Called from native code when a rendering queue buffer is released
+    private static void fwkDerefAll(Ref[] refs) {
+        for (Ref r : refs) {
+            r.deref();
+        }
+    }
+
     public boolean hasRefs() {
         return count > 0;
     }
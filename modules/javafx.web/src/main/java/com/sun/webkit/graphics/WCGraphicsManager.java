@@ -69,6 +69,17 @@ public abstract class WCGraphicsManager {
 
     public abstract WCPageBackBuffer createPageBackBuffer();
 
+    /**
+     * Decodes {@code rq} into an offscreen surface that covers the
+     * {@code (x, y, w, h)} page rectangle at the given scale, and returns
+     * its pixels as non-premultiplied RGBA bytes, row by row, with
+     * {@code ceil(w * scale)} pixels per row. Returns {@code null} if no
+     * offscreen surface can be created. The render queue is always disposed.
+     */
+    public abstract ByteBuffer renderOffscreen(WCRenderQueue rq,
+                                               int x, int y, int w, int h,
+                                               float scale);
+
     protected abstract WCFont getWCFont(String name, boolean bold, boolean italic, float size);
 
     private WCFontCustomPlatformData fwkCreateFontCustomPlatformData(
@@ -131,9 +142,6 @@ public abstract class WCGraphicsManager {
         }
     }
 
-    protected abstract WCTransform createTransform(double m00, double m10,
-            double m01, double m11, double m02, double m12);
-
     protected String[] getSupportedMediaTypes() {
         // default implementation: nothing is supported
         return new String[0];
@@ -25,9 +25,44 @@
 
 package com.sun.webkit.graphics;
 
+import java.util.concurrent.atomic.AtomicLongArray;
 
 public abstract class WCImageDecoder {
 
+    // Bucket 0 counts decodes under 1 ms, bucket i in [1, 10] counts
+    // decodes of [2^(i-1), 2^i) ms, and the last bucket everything slower.
+    private static final int DECODE_TIME_BUCKETS = 12;
+    private static final AtomicLongArray decodeTimes =
+            new AtomicLongArray(DECODE_TIME_BUCKETS);
+
+    /**
+     * Records the time taken by a complete image decode.
+     *
+     * @param nanos decode time in nanoseconds
+     */
+    protected static void recordDecodeTime(long nanos) {
+        long ms = nanos / 1_000_000L;
+        int bucket = ms <= 0 ? 0 : 64 - Long.numberOfLeadingZeros(ms);
+        decodeTimes.incrementAndGet(Math.min(bucket, DECODE_TIME_BUCKETS - 1));
+    }
+
+    /**
+     * Returns the histogram of complete image decode times. Element 0
+     * counts decodes that took less than 1 ms, element {@code i} from 1
+     * to 10 counts decodes that took from {@code 2^(i-1)} ms to less than
+     * {@code 2^i} ms, and the last element counts decodes of 1024 ms or
+     * more.
+     *
+     * @return a copy of the histogram
+     */
+    public static long[] getDecodeTimeHistogram() {
+        long[] histogram = new long[DECODE_TIME_BUCKETS];
+        for (int i = 0; i < histogram.length; i++) {
+            histogram[i] = decodeTimes.get(i);
+        }
+        return histogram;
+    }
+
     /**
      * Receives a portion of image data.
      *
@@ -103,6 +103,28 @@ public abstract class WCRenderQueue extends Ref {
         dispose();
     }
 
+    /*
+     * Decodes the queue into the given context without disposing it, so that
+     * a recorded queue can be drawn more than once (e.g. by a printer that
+     * renders a page in bands). The owner must call dispose() when done.
+     */
+    public synchronized void replay(WCGraphicsContext gc) {
+        if (gc == null || !gc.isValid()) {
+            log.fine("WCRenderQueue::replay : GC is " + (gc == null ? "null" : " invalid"));
+            return;
+        }
+
+        for (BufferData bdata : buffers) {
+            bdata.getBuffer().rewind();
+            try {
+                GraphicsDecoder.decode(
+                    WCGraphicsManager.getGraphicsManager(), gc, bdata);
+            } catch (RuntimeException e) {
+                e.printStackTrace(System.err);
+            }
+        }
+    }
+
     public synchronized void decode() {
         if (gc == null || !gc.isValid()) {
             log.fine("WCRenderQueue::decode : GC is " + (gc == null ? "null" : " invalid"));
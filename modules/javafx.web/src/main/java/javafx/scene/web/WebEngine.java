@@ -27,7 +27,6 @@ package javafx.scene.web;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.scene.web.Debugger;
-import com.sun.javafx.scene.web.Printable;
 import com.sun.javafx.tk.TKPulseListener;
 import com.sun.javafx.tk.Toolkit;
 import com.sun.javafx.webkit.*;
@@ -48,9 +47,6 @@ import javafx.concurrent.Worker;
 import javafx.event.EventHandler;
 import javafx.event.EventType;
 import javafx.geometry.Rectangle2D;
-import javafx.print.JobSettings;
-import javafx.print.PageLayout;
-import javafx.print.PageRange;
 import javafx.print.PrinterJob;
 import javafx.scene.Node;
 import javafx.util.Callback;
@@ -629,8 +625,12 @@ final public class WebEngine {
      * data.
      *
      * <p>Currently, the directory specified by this property is used
-     * only to store the data that backs the {@code window.localStorage}
-     * objects. In the future, more types of data can be added.
+     * to store the data that backs the {@code window.localStorage}
+     * objects and the IndexedDB databases. IndexedDB databases are shared
+     * by all {@code WebEngine}s of the application and are stored in the
+     * directory of the first {@code WebEngine} that applies one; a warning
+     * is logged when another {@code WebEngine} uses a different directory.
+     * In the future, more types of data can be added.
      *
      * @defaultValue {@code null}
      * @since JavaFX 8.0
@@ -1025,9 +1025,11 @@ final public class WebEngine {
             try {
                 userDataDir = DirectoryLock.canonicalize(userDataDir);
                 File localStorageDir = new File(userDataDir, "localstorage");
+                File indexedDatabaseDir = new File(userDataDir, "indexeddb");
                 File[] dirs = new File[] {
                     userDataDir,
                     localStorageDir,
+                    indexedDatabaseDir,
                 };
                 for (File dir : dirs) {
                     createDirectories(dir);
@@ -1042,6 +1044,21 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                if (!page.setIndexedDatabasePath(indexedDatabaseDir.getPath())) {
+                    logger.warning("IndexedDB databases are not stored in [{0}], "
+                            + "another user data directory was applied first",
+                            displayString);
+                }
+                if (WebPage.isBytecodeCacheRequested()) {
+                    File bytecodeCacheDir = new File(userDataDir, "bytecodecache");
+                    createDirectories(bytecodeCacheDir);
+                    WebPage.setWarmUpProfileEnabled(WebPage.isWarmUpProfileRequested());
+                    if (!WebPage.setBytecodeCachePath(bytecodeCacheDir.getPath())) {
+                        logger.warning("Bytecode is not cached in [{0}], "
+                                + "another user data directory was applied first",
+                                displayString);
+                    }
+                }
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
@@ -1589,16 +1606,6 @@ final public class WebEngine {
         }
     }
 
-    private static final boolean printStatusOK(PrinterJob job) {
-        switch (job.getJobStatus()) {
-            case NOT_STARTED:
-            case PRINTING:
-                return true;
-            default:
-                return false;
-        }
-    }
-
     /**
      * Prints the current Web page using the given printer job.
      * <p>This method does not modify the state of the job, nor does it call
@@ -1608,34 +1615,8 @@ final public class WebEngine {
      * @since JavaFX 8.0
      */
     public void print(PrinterJob job) {
-        if (!printStatusOK(job)) {
-            return;
-        }
-
-        PageLayout pl = job.getJobSettings().getPageLayout();
-        float width = (float) pl.getPrintableWidth();
-        float height = (float) pl.getPrintableHeight();
-        int pageCount = page.beginPrinting(width, height);
-
-        JobSettings jobSettings = job.getJobSettings();
-        if (jobSettings.getPageRanges() != null) {
-            PageRange[] pageRanges = jobSettings.getPageRanges();
-            for (PageRange p : pageRanges) {
-                for (int i = p.getStartPage(); i <= p.getEndPage() && i <= pageCount; ++i) {
-                    if (printStatusOK(job)) {
-                        Node printable = new Printable(page, i - 1, width);
-                        job.printPage(printable);
-                    }
-                }
-            }
-        } else {
-            for (int i = 0; i < pageCount; i++) {
-                if (printStatusOK(job)) {
-                    Node printable = new Printable(page, i, width);
-                    job.printPage(printable);
-                }
-            }
-        }
-        page.endPrinting();
+        page.print(job, null);
+    }
+        return batch;
     }
 }
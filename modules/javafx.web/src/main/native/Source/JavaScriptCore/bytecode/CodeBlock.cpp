@@ -2706,6 +2706,7 @@ void CodeBlock::setOptimizationThresholdBasedOnCompilationResult(CompilationResu
     case CompilationSuccessful:
         RELEASE_ASSERT(replacement && JITCode::isOptimizingJIT(replacement->jitType()));
         optimizeNextInvocation();
+        didTierUp(WarmUpTier::Optimizing);
         return;
     case CompilationFailed:
         dontOptimizeAnytimeSoon();
@@ -2977,6 +2978,14 @@ bool CodeBlock::shouldOptimizeNow()
 
     ASSERT(m_optimizationDelayCounter < std::numeric_limits<uint8_t>::max());
     m_optimizationDelayCounter++;
+    if (m_hasWarmUpOptimizeHint) {
+        // Value profiles are rarely full the first time a warm-up hint fires.
+        // Retry after another short warm-up instead of a full one.
+        m_hasWarmUpOptimizeHint = false;
+        m_jitExecuteCounter.setNewThreshold(
+            adjustedCounterValue(Options::thresholdForOptimizeWithWarmUpProfile()), this);
+        return false;
+    }
     optimizeAfterWarmUp();
     return false;
 }
@@ -3491,6 +3500,36 @@ void CodeBlock::jitSoon()
     m_llintExecuteCounter.setNewThreshold(thresholdForJIT(Options::thresholdForJITSoon()), this);
 }
 
+void CodeBlock::applyWarmUpTier(WarmUpTier tier)
+{
+    switch (tier) {
+    case WarmUpTier::None:
+        return;
+    case WarmUpTier::Optimizing:
+        dataLogLnIf(Options::verboseOSR(), *this, ": Optimizing early after an earlier session.");
+#if ENABLE(DFG_JIT)
+        // shouldOptimizeNow() still holds the compile back until the value
+        // profiles are full enough.
+        m_jitExecuteCounter.setNewThreshold(
+            adjustedCounterValue(Options::thresholdForOptimizeWithWarmUpProfile()), this);
+        m_hasWarmUpOptimizeHint = true;
+#endif
+        FALLTHROUGH;
+    case WarmUpTier::Baseline:
+        m_llintExecuteCounter.setNewThreshold(thresholdForJIT(Options::thresholdForJITWithWarmUpProfile()), this);
+        return;
+    }
+}
+
+void CodeBlock::didTierUp(WarmUpTier tier)
+{
+    auto* executable = jsDynamicCast<FunctionExecutable*>(vm(), ownerExecutable());
+    if (!executable)
+        return;
+    const SourceCode& source = executable->source();
+    source.provider()->didTierUp(source.startOffset(), source.endOffset(), specializationKind(), tier);
+}
+
 bool CodeBlock::hasInstalledVMTrapBreakpoints() const
 {
 #if ENABLE(SIGNAL_BASED_VM_TRAPS)
@@ -645,6 +645,12 @@ public:
     void jitAfterWarmUp();
     void jitSoon();
 
+    // Tiers up early if the function ran hot in an earlier session, as
+    // remembered by SourceProvider::warmUpTier().
+    void applyWarmUpTier(WarmUpTier);
+    // Reports a successful tier-up to the source provider.
+    void didTierUp(WarmUpTier);
+
     const BaselineExecutionCounter& llintExecuteCounter() const
     {
         return m_llintExecuteCounter;
@@ -850,6 +856,8 @@ public:
     bool m_hasLinkedOSRExit : 1;
     bool m_isEligibleForLLIntDowngrade : 1;
     bool m_visitChildrenSkippedDueToOldAge { false };
+    // Set by applyWarmUpTier() until the first shouldOptimizeNow() deferral.
+    bool m_hasWarmUpOptimizeHint { false };
 
     // Internal methods for use by validation code. It would be private if it wasn't
     // for the fact that we use it from anonymous namespaces.
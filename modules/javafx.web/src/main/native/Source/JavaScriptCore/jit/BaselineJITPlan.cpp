@@ -63,6 +63,7 @@ CompilationResult BaselineJITPlan::finalize()
         dataLogLnIf(Options::verboseOSR(), "    JIT compilation successful.");
         m_codeBlock->ownerExecutable()->installCode(m_codeBlock);
         m_codeBlock->jitSoon();
+        m_codeBlock->didTierUp(WarmUpTier::Baseline);
         break;
     default:
         RELEASE_ASSERT_NOT_REACHED();
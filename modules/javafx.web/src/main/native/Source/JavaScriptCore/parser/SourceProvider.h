@@ -49,6 +49,14 @@ class UnlinkedFunctionCodeBlock;
 
     using BytecodeCacheGenerator = Function<RefPtr<CachedBytecode>()>;
 
+    // Highest tier a function reached, as remembered across sessions by
+    // embedders that persist warm-up profiles.
+    enum class WarmUpTier : uint8_t {
+        None,
+        Baseline,
+        Optimizing,
+    };
+
     class SourceProvider : public RefCounted<SourceProvider> {
     public:
         static const intptr_t nullID = 1;
@@ -64,6 +72,10 @@ class UnlinkedFunctionCodeBlock;
         virtual void updateCache(const UnlinkedFunctionExecutable*, const SourceCode&, CodeSpecializationKind, const UnlinkedFunctionCodeBlock*) const { }
         virtual void commitCachedBytecode() const { }
 
+        // Functions are identified by their offsets in this provider's source.
+        virtual WarmUpTier warmUpTier(unsigned /* startOffset */, unsigned /* endOffset */, CodeSpecializationKind) const { return WarmUpTier::None; }
+        virtual void didTierUp(unsigned /* startOffset */, unsigned /* endOffset */, CodeSpecializationKind, WarmUpTier) const { }
+
         StringView getRange(int start, int end) const
         {
             return source().substring(start, end - start);
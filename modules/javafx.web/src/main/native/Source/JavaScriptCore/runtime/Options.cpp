@@ -332,6 +332,8 @@ static void scaleJITPolicy()
     scaleOption(Options::thresholdForOptimizeAfterWarmUp(), 1);
     scaleOption(Options::thresholdForOptimizeAfterLongWarmUp(), 1);
     scaleOption(Options::thresholdForOptimizeSoon(), 1);
+    scaleOption(Options::thresholdForJITWithWarmUpProfile(), 0);
+    scaleOption(Options::thresholdForOptimizeWithWarmUpProfile(), 1);
     scaleOption(Options::thresholdForFTLOptimizeSoon(), 2);
     scaleOption(Options::thresholdForFTLOptimizeAfterWarmUp(), 2);
 }
@@ -502,6 +504,8 @@ void Options::recomputeDependentOptions()
         Options::thresholdForOptimizeAfterWarmUp() = 20;
         Options::thresholdForOptimizeAfterLongWarmUp() = 20;
         Options::thresholdForOptimizeSoon() = 20;
+        Options::thresholdForJITWithWarmUpProfile() = 10;
+        Options::thresholdForOptimizeWithWarmUpProfile() = 20;
         Options::thresholdForFTLOptimizeAfterWarmUp() = 20;
         Options::thresholdForFTLOptimizeSoon() = 20;
         Options::maximumEvalCacheableSourceLength() = 150000;
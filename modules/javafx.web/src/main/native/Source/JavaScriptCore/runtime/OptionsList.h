@@ -296,6 +296,8 @@ bool canUseWebAssemblyFastMemory();
     v(Int32, thresholdForOptimizeAfterWarmUp, 1000, Normal, nullptr) \
     v(Int32, thresholdForOptimizeAfterLongWarmUp, 1000, Normal, nullptr) \
     v(Int32, thresholdForOptimizeSoon, 1000, Normal, nullptr) \
+    v(Int32, thresholdForJITWithWarmUpProfile, 20, Normal, "LLInt threshold for functions that reached Baseline in an earlier session") \
+    v(Int32, thresholdForOptimizeWithWarmUpProfile, 250, Normal, "Baseline threshold for functions that reached the optimizing tiers in an earlier session") \
     v(Int32, executionCounterIncrementForLoop, 1, Normal, nullptr) \
     v(Int32, executionCounterIncrementForEntry, 15, Normal, nullptr) \
     \
@@ -342,6 +342,10 @@ CodeBlock* ScriptExecutable::newCodeBlockFor(
     auto* codeBlock = FunctionCodeBlock::create(vm, executable, unlinkedCodeBlock, scope);
     if (throwScope.exception())
         exception = throwScope.exception();
+    else if (codeBlock) {
+        const SourceCode& source = executable->source();
+        codeBlock->applyWarmUpTier(source.provider()->warmUpTier(source.startOffset(), source.endOffset(), kind));
+    }
     return codeBlock;
 }
 
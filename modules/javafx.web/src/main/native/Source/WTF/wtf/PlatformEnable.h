@@ -705,7 +705,10 @@
 #define ENABLE_SAMPLING_PROFILER 1
 #endif
 
-#if ENABLE(WEBASSEMBLY) && HAVE(MACHINE_CONTEXT)
+/* The Java port does not use signaling memory: the JVM owns SIGSEGV, and reserving
+ * several GB of address space per WebAssembly memory competes with the Java heap.
+ * Memories are bounds checked instead. */
+#if ENABLE(WEBASSEMBLY) && HAVE(MACHINE_CONTEXT) && !PLATFORM(JAVA)
 #define ENABLE_WEBASSEMBLY_SIGNALING_MEMORY 1
 #endif
 
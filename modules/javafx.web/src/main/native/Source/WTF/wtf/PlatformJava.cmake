@@ -119,6 +119,7 @@ endif ()
 
 if (UNIX)
     list(APPEND WTF_SOURCES
+        posix/FileSystemPOSIX.cpp
         posix/OSAllocatorPOSIX.cpp
         posix/ThreadingPOSIX.cpp
     )
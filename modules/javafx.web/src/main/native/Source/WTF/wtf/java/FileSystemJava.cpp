@@ -29,16 +29,120 @@
 #include <wtf/java/JavaEnv.h>
 #include <wtf/text/CString.h>
 
+#if OS(UNIX)
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace WTF {
 
 namespace FileSystemImpl {
 
+#if OS(UNIX)
+// -----------------------------------------------------------------------
+// On Unix the file system is accessed natively unless a Java
+// SecurityManager is installed, in which case every path based operation
+// goes through com.sun.webkit.FileSystem so that the policy is enforced.
+// File handles are plain descriptors, see posix/FileSystemPOSIX.cpp.
+// -----------------------------------------------------------------------
+static bool useNativeFileSystem()
+{
+    static bool result = [] {
+        JNIEnv* env = WTF::GetJavaEnv();
+
+        static jmethodID mid = env->GetStaticMethodID(
+                comSunWebkitFileSystem,
+                "fwkUseNativeFileSystem",
+                "()Z");
+        ASSERT(mid);
+
+        jboolean value = env->CallStaticBooleanMethod(comSunWebkitFileSystem, mid);
+        if (WTF::CheckAndClearException(env)) {
+            return false;
+        }
+        return jbool_to_bool(value);
+    }();
+    return result;
+}
+
+// Called by openFile() in posix/FileSystemPOSIX.cpp before a descriptor is opened.
+bool isFileAccessAllowed(const String& path, FileOpenMode mode)
+{
+    if (useNativeFileSystem()) {
+        return true;
+    }
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkCheckFileAccess",
+            "(Ljava/lang/String;Z)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env),
+            bool_to_jbool(mode != FileOpenMode::Read));
+    if (WTF::CheckAndClearException(env)) {
+        return false;
+    }
+    return jbool_to_bool(result);
+}
+
+static std::optional<struct stat> nativeStat(const String& path, bool followSymlinks = true)
+{
+    CString fsRep = fileSystemRepresentation(path);
+    if (fsRep.isNull()) {
+        return { };
+    }
+    struct stat fileInfo;
+    if ((followSymlinks ? stat(fsRep.data(), &fileInfo) : lstat(fsRep.data(), &fileInfo))) {
+        return { };
+    }
+    return fileInfo;
+}
+
+static bool makeAllDirectoriesNative(const String& path)
+{
+    CString fullPath = fileSystemRepresentation(path);
+    if (fullPath.isNull() || !fullPath.length()) {
+        return false;
+    }
+    if (!access(fullPath.data(), F_OK)) {
+        return true;
+    }
+
+    char* p = fullPath.mutableData() + 1;
+    for (; *p; ++p) {
+        if (*p == '/') {
+            *p = '\0';
+            if (mkdir(fullPath.data(), 0777) && errno != EEXIST) {
+                return false;
+            }
+            *p = '/';
+        }
+    }
+    return !mkdir(fullPath.data(), 0777) || errno == EEXIST;
+}
+#endif
+
 
 // -----------------------------------------------------------------------
 //  Below methods use Java calls to implement the intended functionality.
 // -----------------------------------------------------------------------
 bool fileExists(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        CString fsRep = fileSystemRepresentation(path);
+        return !fsRep.isNull() && !access(fsRep.data(), F_OK);
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -59,6 +163,16 @@ bool fileExists(const String& path)
 
 bool getFileSize(const String& path, long long& result)
 {
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        auto fileInfo = nativeStat(path);
+        if (!fileInfo) {
+            return false;
+        }
+        result = fileInfo->st_size;
+        return true;
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -84,12 +198,28 @@ bool getFileSize(const String& path, long long& result)
 std::optional<uint64_t> fileSize(const String& path)
 {
     long long size = 0;
-    getFileSize(path, size);
+    if (!getFileSize(path, size)) {
+        return { };
+    }
     return size;
 }
 
 std::optional<FileMetadata> fileMetadata(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        auto fileInfo = nativeStat(path);
+        if (!fileInfo) {
+            return { };
+        }
+        FileMetadata metadata {};
+        metadata.modificationTime = WallTime::fromRawSeconds(fileInfo->st_mtime);
+        metadata.length = fileInfo->st_size;
+        metadata.isHidden = isHiddenFile(path);
+        metadata.type = S_ISDIR(fileInfo->st_mode) ? FileMetadata::Type::Directory : FileMetadata::Type::File;
+        return metadata;
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -111,8 +241,10 @@ std::optional<FileMetadata> fileMetadata(const String& path)
         FileMetadata metadata {};
         metadata.modificationTime = WallTime::fromRawSeconds(metadataResults[0] / 1000.0);
         metadata.length = metadataResults[1];
-        metadata.type = static_cast<FileMetadata::Type>(metadataResults[2]);
-        env->ReleaseLongArrayElements(lArray, metadataResults, 0);
+        jlong type = metadataResults[2];
+        env->ReleaseLongArrayElements(lArray, metadataResults, JNI_ABORT);
+        // Type codes must match com.sun.webkit.FileSystem.TYPE_*
+        metadata.type = (type == 2) ? FileMetadata::Type::Directory : FileMetadata::Type::File;
         return metadata;
     }
     return {};
@@ -146,6 +278,15 @@ String pathByAppendingComponents(StringView path, const Vector<StringView>& comp
 
 String pathByAppendingComponent(const String& path, const String& component)
 {
+#if OS(UNIX)
+    if (path.isEmpty()) {
+        return component;
+    }
+    if (path.endsWith('/')) {
+        return path + component;
+    }
+    return path + "/" + component;
+#else
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -162,10 +303,16 @@ String pathByAppendingComponent(const String& path, const String& component)
     WTF::CheckAndClearException(env);
 
     return String(env, result);
+#endif
 }
 
 bool makeAllDirectories(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        return makeAllDirectoriesNative(path);
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -184,6 +331,7 @@ bool makeAllDirectories(const String& path)
 }
 
 
+#if !OS(UNIX)
 CString fileSystemRepresentation(const String& s)
 {
     return CString(s.latin1().data());
@@ -191,7 +339,7 @@ CString fileSystemRepresentation(const String& s)
 
 PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, bool)
 {
-    if (mode != FileOpenMode::Read) {
+    if (mode != FileOpenMode::Read && mode != FileOpenMode::Write) {
         return invalidPlatformFileHandle;
     }
     JNIEnv* env = WTF::GetJavaEnv();
@@ -204,10 +352,65 @@ PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPer
     PlatformFileHandle result = env->CallStaticObjectMethod(
             comSunWebkitFileSystem,
             mid,
-            (jstring)path.toJavaString(env), (jstring)(env->NewStringUTF("r")));
+            (jstring)path.toJavaString(env),
+            (jstring)(env->NewStringUTF(mode == FileOpenMode::Read ? "r" : "rw")));
+
+    WTF::CheckAndClearException(env);
+    if (!result) {
+        return invalidPlatformFileHandle;
+    }
+    // FileOpenMode::Write has O_TRUNC semantics on the other ports.
+    if (mode == FileOpenMode::Write && !truncateFile(result, 0)) {
+        closeFile(result);
+        return invalidPlatformFileHandle;
+    }
+    return result;
+}
+
+int writeToFile(PlatformFileHandle handle, const void* data, int length)
+{
+    if (length < 0 || !isHandleValid(handle) || data == nullptr) {
+        return -1;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkWriteToFile",
+            "(Ljava/io/RandomAccessFile;Ljava/nio/ByteBuffer;)I");
+    ASSERT(mid);
 
+    int result = env->CallStaticIntMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle,
+            (jobject)JLObject(env->NewDirectByteBuffer(const_cast<void*>(data), length)));
     WTF::CheckAndClearException(env);
-    return result ? result : invalidPlatformFileHandle;
+
+    if (result < 0) {
+        return -1;
+    }
+    return result;
+}
+
+bool truncateFile(PlatformFileHandle handle, long long offset)
+{
+    if (offset < 0 || !isHandleValid(handle)) {
+        return false;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkTruncateFile",
+            "(Ljava/io/RandomAccessFile;J)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle, (jlong)offset);
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
 void closeFile(PlatformFileHandle& handle)
@@ -252,6 +455,7 @@ int readFromFile(PlatformFileHandle handle, void* data, int length)
     }
     return result;
 }
+#endif
 
 String pathGetFileName(const String& path)
 {
@@ -272,6 +476,7 @@ String pathGetFileName(const String& path)
     return String(env, result);
 }
 
+#if !OS(UNIX)
 long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
 {
     // we always get positive value for offset from webkit.
@@ -295,6 +500,192 @@ long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
     }
     return offset;
 }
+#endif
+
+Vector<String> listDirectory(const String& path)
+{
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        Vector<String> entries;
+        CString fsRep = fileSystemRepresentation(path);
+        DIR* directory = fsRep.isNull() ? nullptr : opendir(fsRep.data());
+        if (!directory) {
+            return entries;
+        }
+        while (auto* entry = readdir(directory)) {
+            const char* name = entry->d_name;
+            if (!strcmp(name, ".") || !strcmp(name, "..")) {
+                continue;
+            }
+            entries.append(stringFromFileSystemRepresentation(name));
+        }
+        closedir(directory);
+        return entries;
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkListDirectory",
+            "(Ljava/lang/String;)[Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLocalRef<jobjectArray> names(static_cast<jobjectArray>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env))));
+    WTF::CheckAndClearException(env);
+
+    Vector<String> entries;
+    if (!names) {
+        return entries;
+    }
+    jsize count = env->GetArrayLength(names);
+    entries.reserveInitialCapacity(count);
+    for (jsize i = 0; i < count; ++i) {
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(names, i)));
+        entries.uncheckedAppend(String(env, name));
+    }
+    return entries;
+}
+
+static bool deletePath(const String& path, bool directory)
+{
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        CString fsRep = fileSystemRepresentation(path);
+        return !fsRep.isNull() && !(directory ? rmdir(fsRep.data()) : unlink(fsRep.data()));
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkDeletePath",
+            "(Ljava/lang/String;Z)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env),
+            bool_to_jbool(directory));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
+}
+
+bool deleteFile(const String& path)
+{
+    return deletePath(path, false);
+}
+
+bool deleteEmptyDirectory(const String& path)
+{
+    return deletePath(path, true);
+}
+
+bool moveFile(const String& oldPath, const String& newPath)
+{
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        CString oldFsRep = fileSystemRepresentation(oldPath);
+        CString newFsRep = fileSystemRepresentation(newPath);
+        if (oldFsRep.isNull() || newFsRep.isNull()) {
+            return false;
+        }
+        if (!rename(oldFsRep.data(), newFsRep.data())) {
+            return true;
+        }
+        // Let Java copy across file systems.
+        if (errno != EXDEV) {
+            return false;
+        }
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkMoveFile",
+            "(Ljava/lang/String;Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)oldPath.toJavaString(env),
+            (jstring)newPath.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
+}
+
+String parentPath(const String& path)
+{
+#if OS(UNIX)
+    size_t position = path.reverseFind('/');
+    if (position == notFound) {
+        return String();
+    }
+    if (!position) {
+        return path.length() > 1 ? "/"_s : String();
+    }
+    return path.left(position);
+#else
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkParentPath",
+            "(Ljava/lang/String;)Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env)));
+    WTF::CheckAndClearException(env);
+
+    return result ? String(env, result) : String();
+#endif
+}
+
+std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
+{
+    std::optional<FileMetadata> metadata = fileMetadata(path);
+    if (!metadata) {
+        return { };
+    }
+    switch (metadata->type) {
+    case FileMetadata::Type::File:
+        return FileType::Regular;
+    case FileMetadata::Type::Directory:
+        return FileType::Directory;
+    case FileMetadata::Type::SymbolicLink:
+        return FileType::SymbolicLink;
+    }
+    return { };
+}
+
+std::optional<FileType> fileType(const String& path)
+{
+#if OS(UNIX)
+    if (useNativeFileSystem()) {
+        auto fileInfo = nativeStat(path, false);
+        if (!fileInfo) {
+            return { };
+        }
+        if (S_ISLNK(fileInfo->st_mode)) {
+            return FileType::SymbolicLink;
+        }
+        return S_ISDIR(fileInfo->st_mode) ? FileType::Directory : FileType::Regular;
+    }
+#endif
+    // java.io.File resolves symbolic links, so both variants behave the same.
+    return fileTypeFollowingSymlinks(path);
+}
 
 
 // -----------------------------------------------------------------------
@@ -302,11 +693,13 @@ long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
 // TODO: Implement the functionality in future using Java calls as and
 // when needed.
 // -----------------------------------------------------------------------
+#if !OS(UNIX)
 std::optional<WallTime> fileCreationTime(const String&) // Not all platforms store file creation time.
 {
     fprintf(stderr, "fileCreationTime(const String&) NOT IMPLEMENTED\n");
     return { };
 }
+#endif
 
 String homeDirectoryPath()
 {
@@ -327,37 +720,15 @@ Vector<String> listDirectory(const String&, const String&)
     return entities;
 }
 
-Vector<String> listDirectory(const String&)
-{
-    fprintf(stderr, "listDirectory(const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
-}
-
-int writeToFile(PlatformFileHandle, const void* data, int length)
-{
-    fprintf(stderr, "writeToFile(PlatformFileHandle, const void* data, int length) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(data);
-    UNUSED_PARAM(length);
-
-    return -1;
-}
-
-bool truncateFile(PlatformFileHandle, long long offset)
-{
-    fprintf(stderr, "truncateFile(PlatformFileHandle, long long offset) NOT IMPLEMENTED\n");
-
-    // FIXME: openjfx2.26 implement truncateFile
-    UNUSED_PARAM(offset);
-    return false;
-}
-
+#if !OS(UNIX)
 std::optional<int32_t> getFileDeviceId(const CString&)
 {
     fprintf(stderr, "getFileDeviceId(const CString&) NOT IMPLEMENTED\n");
     return {};
 }
+#endif
 
+#if !HAVE(MMAP) || !OS(UNIX)
 bool MappedFileData::mapFileHandle(PlatformFileHandle, FileOpenMode, MappedFileMode)
 {
     fprintf(stderr, "MappedFileData::mapFileHandle(PlatformFileHandle handle, MappedFileMode) NOT IMPLEMENTED\n");
@@ -376,47 +747,26 @@ MappedFileData::~MappedFileData()
         return;
     unmapViewOfFile(m_fileData, m_fileSize);
 }
+#endif
 
-bool deleteFile(const String&)
-{
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
-}
-
-bool deleteEmptyDirectory(String const &)
-{
-    fprintf(stderr, "deleteEmptyDirectory(String const &) NOT IMPLEMENTED\n");
-    return false;
-}
-
+#if !OS(UNIX)
 String openTemporaryFile(const String&, PlatformFileHandle& handle, const String&)
 {
     fprintf(stderr, "openTemporaryFile(const String&, PlatformFileHandle& handle, const String&) NOT IMPLEMENTED\n");
     handle = invalidPlatformFileHandle;
     return String();
 }
-
-String parentPath(const String& path)
-{
-    fprintf(stderr, "parentPath(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return "";
-}
-
-bool moveFile(const String& oldPath, const String& newPath)
-{
-    fprintf(stderr, "moveFile(const String& oldPath, const String& newPath) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(oldPath);
-    UNUSED_PARAM(newPath);
-
-    return false;
-}
+#endif
 
 bool isHiddenFile(const String& path)
 {
+#if OS(UNIX)
+    return pathFileName(path).startsWith('.');
+#else
     fprintf(stderr, "isHiddenFile(const String& path) NOT IMPLEMENTED\n");
     UNUSED_PARAM(path);
     return false;
+#endif
 }
 
 String pathFileName(const String& path)
@@ -433,20 +783,6 @@ bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
     return false;
 }
 
-std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
-{
-    fprintf(stderr, "fileTypeFollowingSymlinks(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return {};
-}
-
-std::optional<FileType> fileType(const String& path)
-{
-    fprintf(stderr, "fileType(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return {};
-}
-
 } // namespace FileSystemImpl
 
 } // namespace WTF
@@ -48,8 +48,18 @@ namespace WTF {
 
 namespace FileSystemImpl {
 
+#if PLATFORM(JAVA)
+// Defined in java/FileSystemJava.cpp, consults the Java SecurityManager if any.
+bool isFileAccessAllowed(const String& path, FileOpenMode);
+#endif
+
 PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission permission, bool failIfFileExists)
 {
+#if PLATFORM(JAVA)
+    if (!isFileAccessAllowed(path, mode))
+        return invalidPlatformFileHandle;
+#endif
+
     CString fsRep = fileSystemRepresentation(path);
 
     if (fsRep.isNull())
@@ -223,6 +233,11 @@ String openTemporaryFile(const String& prefix, PlatformFileHandle& handle, const
     if (snprintf(buffer, PATH_MAX, "%s/%sXXXXXX", tmpDir, prefix.utf8().data()) >= PATH_MAX)
         goto end;
 
+#if PLATFORM(JAVA)
+    if (!isFileAccessAllowed(String::fromUTF8(tmpDir), FileOpenMode::Write))
+        goto end;
+#endif
+
     handle = mkstemp(buffer);
     if (handle < 0)
         goto end;
@@ -80,6 +80,7 @@ add_definitions(-DSTATICALLY_LINKED_WITH_JavaScriptCore)
 add_definitions(-DSTATICALLY_LINKED_WITH_WTF)
 
 list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
+    bindings/java/BytecodeCacheJava.h
     bindings/java/JavaDOMUtils.h
     bindings/java/JavaEventListener.h
     bindings/java/JavaNodeFilterCondition.h
@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BytecodeCacheJava.h"
+
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <JavaScriptCore/VM.h>
+#include <wtf/FileSystem.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Scope.h>
+#include <wtf/WorkQueue.h>
+#include <wtf/text/CString.h>
+
+namespace WebCore {
+
+namespace {
+
+constexpr uint32_t cacheFileMagic = 0x4a464243; // 'JFBC'
+constexpr uint32_t cacheFileVersion = 1;
+
+// Scripts shorter than this parse faster than the cache file can be read.
+constexpr unsigned minimumSourceLength = 4096;
+
+struct CacheFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceLength;
+    uint64_t generationTimeMicroseconds;
+    SHA1::Digest sourceDigest;
+};
+
+constexpr uint32_t warmUpProfileMagic = 0x4a465750; // 'JFWP'
+constexpr uint32_t warmUpProfileVersion = 1;
+
+struct WarmUpProfileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceLength;
+    SHA1::Digest sourceDigest;
+    uint32_t entryCount;
+};
+
+struct WarmUpProfileRecord {
+    uint32_t startOffset;
+    uint32_t endOffset;
+    uint8_t kind;
+    uint8_t tier;
+    uint16_t padding;
+};
+
+Lock directoryLock;
+std::atomic<bool> cacheEnabled { false };
+std::atomic<uint64_t> hitCount { 0 };
+std::atomic<uint64_t> missCount { 0 };
+std::atomic<uint64_t> storeCount { 0 };
+std::atomic<uint64_t> loadedByteCount { 0 };
+std::atomic<uint64_t> storedByteCount { 0 };
+std::atomic<int64_t> savedGenerationMicroseconds { 0 };
+std::atomic<bool> warmUpProfileEnabled { true };
+std::atomic<uint64_t> warmUpProfileLoadCount { 0 };
+std::atomic<uint64_t> warmUpProfileStoreCount { 0 };
+std::atomic<uint64_t> warmUpHintCount { 0 };
+std::atomic<uint64_t> warmUpTierUpCount { 0 };
+std::atomic<uint64_t> coldScriptCount { 0 };
+std::atomic<int64_t> coldSteadyStateMicroseconds { 0 };
+std::atomic<uint64_t> warmScriptCount { 0 };
+std::atomic<int64_t> warmSteadyStateMicroseconds { 0 };
+
+String& cacheDirectory() WTF_REQUIRES_LOCK(directoryLock)
+{
+    static NeverDestroyed<String> directory;
+    return directory;
+}
+
+WorkQueue& writeQueue()
+{
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("com.sun.webkit.BytecodeCache"));
+    return queue.get();
+}
+
+bool readFully(FileSystem::PlatformFileHandle& handle, void* data, size_t length)
+{
+    auto* bytes = static_cast<uint8_t*>(data);
+    while (length) {
+        int read = FileSystem::readFromFile(handle, bytes, static_cast<int>(std::min<size_t>(length, std::numeric_limits<int>::max())));
+        if (read <= 0)
+            return false;
+        bytes += read;
+        length -= read;
+    }
+    return true;
+}
+
+bool writeFully(FileSystem::PlatformFileHandle& handle, const void* data, size_t length)
+{
+    auto* bytes = static_cast<const uint8_t*>(data);
+    while (length) {
+        int written = FileSystem::writeToFile(handle, bytes, static_cast<int>(std::min<size_t>(length, std::numeric_limits<int>::max())));
+        if (written <= 0)
+            return false;
+        bytes += written;
+        length -= written;
+    }
+    return true;
+}
+
+void addSource(SHA1& sha1, StringView source)
+{
+    if (source.is8Bit())
+        sha1.addBytes(source.characters8(), source.length());
+    else
+        sha1.addBytes(reinterpret_cast<const uint8_t*>(source.characters16()), source.length() * sizeof(UChar));
+}
+
+// Source offsets are below 2^31, so both fit next to the specialization kind.
+uint64_t warmUpKey(unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind kind)
+{
+    return static_cast<uint64_t>(startOffset) << 33 | static_cast<uint64_t>(endOffset) << 1 | static_cast<uint64_t>(kind);
+}
+
+// Writes to a temporary file first so a reader never sees a partial entry.
+// |didStore| runs on the write queue once the file is in place.
+void writeCacheFile(const String& path, Vector<uint8_t>&& contents, void (*didStore)(size_t))
+{
+    writeQueue().dispatch([path = path.isolatedCopy(), contents = WTFMove(contents), didStore] {
+        String temporaryPath = makeString(path, ".tmp");
+        auto handle = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Write);
+        if (!FileSystem::isHandleValid(handle))
+            return;
+        bool success = writeFully(handle, contents.data(), contents.size());
+        FileSystem::closeFile(handle);
+        if (!success || !FileSystem::moveFile(temporaryPath, path)) {
+            FileSystem::deleteFile(temporaryPath);
+            return;
+        }
+        didStore(contents.size());
+    });
+}
+
+} // namespace
+
+bool BytecodeCacheJava::setDirectory(const String& directory)
+{
+    Locker locker { directoryLock };
+    // Entries of live scripts keep the paths they were prepared with.
+    if (!cacheDirectory().isEmpty())
+        return cacheDirectory() == directory;
+    if (directory.isEmpty())
+        return false;
+    cacheDirectory() = directory.isolatedCopy();
+    cacheEnabled = true;
+    return true;
+}
+
+bool BytecodeCacheJava::isEnabled()
+{
+    return cacheEnabled;
+}
+
+BytecodeCacheJava::Statistics BytecodeCacheJava::statistics()
+{
+    Statistics statistics;
+    statistics.hits = hitCount;
+    statistics.misses = missCount;
+    statistics.stores = storeCount;
+    statistics.bytesLoaded = loadedByteCount;
+    statistics.bytesStored = storedByteCount;
+    statistics.savedGenerationTime = Seconds::fromMicroseconds(savedGenerationMicroseconds.load());
+    statistics.warmUpProfilesLoaded = warmUpProfileLoadCount;
+    statistics.warmUpProfilesStored = warmUpProfileStoreCount;
+    statistics.warmUpHints = warmUpHintCount;
+    statistics.warmUpTierUps = warmUpTierUpCount;
+    statistics.coldScripts = coldScriptCount;
+    statistics.coldTimeToSteadyState = Seconds::fromMicroseconds(coldSteadyStateMicroseconds.load());
+    statistics.warmScripts = warmScriptCount;
+    statistics.warmTimeToSteadyState = Seconds::fromMicroseconds(warmSteadyStateMicroseconds.load());
+    return statistics;
+}
+
+void BytecodeCacheJava::setWarmUpProfileEnabled(bool enabled)
+{
+    warmUpProfileEnabled = enabled;
+}
+
+bool BytecodeCacheJava::isWarmUpProfileEnabled()
+{
+    return warmUpProfileEnabled && isEnabled();
+}
+
+bool BytecodeCacheJava::Entry::prepare(const JSC::SourceProvider& provider)
+{
+    if (m_prepared)
+        return !m_path.isNull();
+    m_prepared = true;
+
+    if (!isEnabled() || provider.sourceURL().isEmpty())
+        return false;
+
+    auto source = provider.source();
+    if (source.length() < minimumSourceLength)
+        return false;
+
+    String directory;
+    {
+        Locker locker { directoryLock };
+        directory = cacheDirectory().isolatedCopy();
+    }
+    if (directory.isEmpty())
+        return false;
+
+    SHA1 urlHash;
+    urlHash.addBytes(provider.sourceURL().utf8());
+    SHA1::Digest urlDigest;
+    urlHash.computeHash(urlDigest);
+    auto fileName = SHA1::hexDigest(urlDigest);
+    m_path = FileSystem::pathByAppendingComponent(directory, makeString(fileName.data(), ".jsbc"));
+    m_warmUpProfilePath = FileSystem::pathByAppendingComponent(directory, makeString(fileName.data(), ".jswp"));
+
+    SHA1 sourceHash;
+    addSource(sourceHash, source);
+    sourceHash.computeHash(m_sourceDigest);
+    m_sourceLength = source.length();
+    return true;
+}
+
+void BytecodeCacheJava::Entry::load()
+{
+    auto fileSize = FileSystem::fileSize(m_path);
+    if (!fileSize || *fileSize <= sizeof(CacheFileHeader))
+        return;
+
+    auto handle = FileSystem::openFile(m_path, FileSystem::FileOpenMode::Read);
+    if (!FileSystem::isHandleValid(handle))
+        return;
+    auto closeFile = makeScopeExit([&] {
+        FileSystem::closeFile(handle);
+    });
+
+    CacheFileHeader header;
+    if (!readFully(handle, &header, sizeof(header)))
+        return;
+    if (header.magic != cacheFileMagic || header.version != cacheFileVersion
+        || header.sourceLength != m_sourceLength || header.sourceDigest != m_sourceDigest)
+        return;
+
+    size_t payloadSize = *fileSize - sizeof(header);
+    auto payload = MallocPtr<uint8_t, JSC::VMMalloc>::malloc(payloadSize);
+    if (!readFully(handle, payload.get(), payloadSize))
+        return;
+
+    m_cachedBytecode = JSC::CachedBytecode::create(WTFMove(payload), payloadSize, { });
+    m_generationTime = Seconds::fromMicroseconds(header.generationTimeMicroseconds);
+}
+
+RefPtr<JSC::CachedBytecode> BytecodeCacheJava::Entry::cachedBytecode(const JSC::SourceProvider& provider)
+{
+    if (!prepare(provider))
+        return nullptr;
+
+    if (!m_cachedBytecode) {
+        load();
+        // JSC parses and generates bytecode right after a miss, or after
+        // rejecting a hit, and hands the result to cacheBytecode(), which
+        // measures the elapsed time.
+        m_lookupTime = MonotonicTime::now();
+        if (m_cachedBytecode) {
+            m_servedFromDisk = true;
+            hitCount++;
+            loadedByteCount += m_cachedBytecode->size();
+            savedGenerationMicroseconds += m_generationTime.microsecondsAs<int64_t>();
+        } else
+            missCount++;
+    }
+    return m_cachedBytecode;
+}
+
+void BytecodeCacheJava::Entry::cacheBytecode(const JSC::SourceProvider& provider, const JSC::BytecodeCacheGenerator& generator)
+{
+    if (!prepare(provider))
+        return;
+
+    if (m_servedFromDisk) {
+        // JSC rejected the entry (e.g. it was written by another JSC version)
+        // and regenerated the code block, so this was a miss after all.
+        m_servedFromDisk = false;
+        hitCount--;
+        missCount++;
+        savedGenerationMicroseconds -= m_generationTime.microsecondsAs<int64_t>();
+        m_cachedBytecode = nullptr;
+    }
+
+    if (m_lookupTime) {
+        m_generationTime = MonotonicTime::now() - m_lookupTime;
+        m_lookupTime = { };
+    }
+
+    auto update = generator();
+    if (!update)
+        return;
+    m_cachedBytecode = JSC::CachedBytecode::create();
+    m_cachedBytecode->addGlobalUpdate(*update);
+    commit();
+}
+
+void BytecodeCacheJava::Entry::updateCache(const JSC::UnlinkedFunctionExecutable* executable, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock)
+{
+    if (!m_cachedBytecode)
+        return;
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (cachedBytecode && !error.isValid())
+        m_cachedBytecode->addFunctionUpdate(executable, kind, *cachedBytecode);
+}
+
+void BytecodeCacheJava::Entry::commit()
+{
+    if (!m_cachedBytecode || !m_cachedBytecode->hasUpdates() || m_path.isNull())
+        return;
+
+    // Apply the pending updates to a flat copy of the payload. The copy
+    // replaces the in-memory entry so later function updates are recorded
+    // relative to what is on disk.
+    size_t size = m_cachedBytecode->sizeForUpdate();
+    auto image = MallocPtr<uint8_t, JSC::VMMalloc>::malloc(size);
+    memcpy(image.get(), m_cachedBytecode->data(), m_cachedBytecode->size());
+    m_cachedBytecode->commitUpdates([&] (off_t offset, const void* data, size_t length) {
+        RELEASE_ASSERT(static_cast<size_t>(offset) + length <= size);
+        memcpy(image.get() + offset, data, length);
+    });
+
+    CacheFileHeader header { cacheFileMagic, cacheFileVersion, m_sourceLength, m_generationTime.microsecondsAs<uint64_t>(), m_sourceDigest };
+    Vector<uint8_t> contents;
+    contents.reserveInitialCapacity(sizeof(header) + size);
+    contents.append(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    contents.append(image.get(), size);
+    writeCacheFile(m_path, WTFMove(contents), [] (size_t size) {
+        storeCount++;
+        storedByteCount += size;
+    });
+
+    auto leafExecutables = WTFMove(m_cachedBytecode->leafExecutables());
+    m_cachedBytecode = JSC::CachedBytecode::create(WTFMove(image), size, WTFMove(leafExecutables));
+}
+
+JSC::WarmUpTier BytecodeCacheJava::Entry::warmUpTier(const JSC::SourceProvider& provider, unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind kind)
+{
+    if (!m_firstCodeBlockTime)
+        m_firstCodeBlockTime = MonotonicTime::now();
+
+    if (!m_warmUpProfileLoaded) {
+        m_warmUpProfileLoaded = true;
+        if (isWarmUpProfileEnabled() && prepare(provider))
+            loadWarmUpProfile();
+    }
+
+    auto tier = m_warmUpTiers.get(warmUpKey(startOffset, endOffset, kind));
+    if (tier != JSC::WarmUpTier::None)
+        warmUpHintCount++;
+    return tier;
+}
+
+void BytecodeCacheJava::Entry::didTierUp(unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind kind, JSC::WarmUpTier tier)
+{
+    // Profiles are only kept for scripts warmUpTier() prepared.
+    if (!m_warmUpProfileLoaded || m_path.isNull() || !isWarmUpProfileEnabled())
+        return;
+
+    warmUpTierUpCount++;
+    m_lastTierUpTime = MonotonicTime::now();
+
+    auto& recordedTier = m_warmUpTiers.add(warmUpKey(startOffset, endOffset, kind), JSC::WarmUpTier::None).iterator->value;
+    if (tier > recordedTier) {
+        recordedTier = tier;
+        m_warmUpProfileChanged = true;
+    }
+}
+
+void BytecodeCacheJava::Entry::finish()
+{
+    commit();
+    commitWarmUpProfile();
+
+    if (m_lastTierUpTime) {
+        auto timeToSteadyState = (m_lastTierUpTime - m_firstCodeBlockTime).microsecondsAs<int64_t>();
+        if (m_hadWarmUpProfile) {
+            warmScriptCount++;
+            warmSteadyStateMicroseconds += timeToSteadyState;
+        } else {
+            coldScriptCount++;
+            coldSteadyStateMicroseconds += timeToSteadyState;
+        }
+    }
+}
+
+void BytecodeCacheJava::Entry::loadWarmUpProfile()
+{
+    auto fileSize = FileSystem::fileSize(m_warmUpProfilePath);
+    if (!fileSize || *fileSize < sizeof(WarmUpProfileHeader))
+        return;
+
+    auto handle = FileSystem::openFile(m_warmUpProfilePath, FileSystem::FileOpenMode::Read);
+    if (!FileSystem::isHandleValid(handle))
+        return;
+    auto closeFile = makeScopeExit([&] {
+        FileSystem::closeFile(handle);
+    });
+
+    WarmUpProfileHeader header;
+    if (!readFully(handle, &header, sizeof(header)))
+        return;
+    if (header.magic != warmUpProfileMagic || header.version != warmUpProfileVersion
+        || header.sourceLength != m_sourceLength || header.sourceDigest != m_sourceDigest
+        || *fileSize != sizeof(header) + static_cast<uint64_t>(header.entryCount) * sizeof(WarmUpProfileRecord))
+        return;
+
+    Vector<WarmUpProfileRecord> records(header.entryCount);
+    if (!readFully(handle, records.data(), records.size() * sizeof(WarmUpProfileRecord)))
+        return;
+
+    for (auto& record : records) {
+        if (record.kind > static_cast<uint8_t>(JSC::CodeForConstruct)
+            || record.tier > static_cast<uint8_t>(JSC::WarmUpTier::Optimizing)
+            || record.startOffset >= record.endOffset || record.endOffset > m_sourceLength)
+            continue;
+        auto kind = static_cast<JSC::CodeSpecializationKind>(record.kind);
+        m_warmUpTiers.set(warmUpKey(record.startOffset, record.endOffset, kind), static_cast<JSC::WarmUpTier>(record.tier));
+    }
+    m_hadWarmUpProfile = !m_warmUpTiers.isEmpty();
+    if (m_hadWarmUpProfile)
+        warmUpProfileLoadCount++;
+}
+
+void BytecodeCacheJava::Entry::commitWarmUpProfile()
+{
+    if (!m_warmUpProfileChanged || m_warmUpProfilePath.isNull())
+        return;
+    m_warmUpProfileChanged = false;
+
+    // The map holds the loaded profile merged with this session's tier-ups.
+    WarmUpProfileHeader header { warmUpProfileMagic, warmUpProfileVersion, m_sourceLength, m_sourceDigest, 0 };
+    Vector<uint8_t> contents;
+    contents.reserveInitialCapacity(sizeof(header) + m_warmUpTiers.size() * sizeof(WarmUpProfileRecord));
+    contents.append(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    for (auto& entry : m_warmUpTiers) {
+        if (entry.value == JSC::WarmUpTier::None)
+            continue;
+        WarmUpProfileRecord record {
+            static_cast<uint32_t>(entry.key >> 33),
+            static_cast<uint32_t>(entry.key >> 1),
+            static_cast<uint8_t>(entry.key & 1),
+            static_cast<uint8_t>(entry.value),
+            0
+        };
+        contents.append(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+        header.entryCount++;
+    }
+    memcpy(contents.data() + offsetof(WarmUpProfileHeader, entryCount), &header.entryCount, sizeof(header.entryCount));
+
+    writeCacheFile(m_warmUpProfilePath, WTFMove(contents), [] (size_t) {
+        warmUpProfileStoreCount++;
+    });
+}
+
+} // namespace WebCore
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/SourceProvider.h>
+#include <wtf/HashMap.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/SHA1.h>
+#include <wtf/Seconds.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// Opt-in on-disk cache of JavaScriptCore bytecode for page scripts.
+// Cache files are named after the script URL and carry a digest of the
+// script text, so a changed script simply overwrites its stale entry.
+class BytecodeCacheJava {
+public:
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t stores { 0 };
+        uint64_t bytesLoaded { 0 };
+        uint64_t bytesStored { 0 };
+        // Parse and bytecode generation time the hits did not have to spend,
+        // as measured when the cache entries were created.
+        Seconds savedGenerationTime;
+
+        uint64_t warmUpProfilesLoaded { 0 };
+        uint64_t warmUpProfilesStored { 0 };
+        // Code blocks tiered up early because of a loaded profile.
+        uint64_t warmUpHints { 0 };
+        uint64_t warmUpTierUps { 0 };
+        // Time from a script's first function code block to its last tier-up,
+        // summed separately for scripts run without and with a profile.
+        uint64_t coldScripts { 0 };
+        Seconds coldTimeToSteadyState;
+        uint64_t warmScripts { 0 };
+        Seconds warmTimeToSteadyState;
+    };
+
+    // The first non-empty directory enables the cache for the rest of the
+    // process, as the IndexedDB directory does. Returns whether entries
+    // are now kept in the given directory.
+    static bool setDirectory(const String&);
+    static bool isEnabled();
+    static Statistics statistics();
+
+    // Warm-up profiles remember the highest tier each function reached and
+    // are kept next to the cache entries, so they need the cache enabled.
+    static void setWarmUpProfileEnabled(bool);
+    static bool isWarmUpProfileEnabled();
+
+    // Per-script cache state, owned by the script's SourceProvider.
+    class Entry {
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        RefPtr<JSC::CachedBytecode> cachedBytecode(const JSC::SourceProvider&);
+        void cacheBytecode(const JSC::SourceProvider&, const JSC::BytecodeCacheGenerator&);
+        void updateCache(const JSC::UnlinkedFunctionExecutable*, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*);
+        void commit();
+
+        JSC::WarmUpTier warmUpTier(const JSC::SourceProvider&, unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind);
+        void didTierUp(unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind, JSC::WarmUpTier);
+        // Commits pending bytecode and writes the warm-up profile.
+        void finish();
+
+    private:
+        bool prepare(const JSC::SourceProvider&);
+        void load();
+        void loadWarmUpProfile();
+        void commitWarmUpProfile();
+
+        String m_path;
+        String m_warmUpProfilePath;
+        SHA1::Digest m_sourceDigest { };
+        uint64_t m_sourceLength { 0 };
+        RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+        MonotonicTime m_lookupTime;
+        Seconds m_generationTime;
+        bool m_prepared { false };
+        bool m_servedFromDisk { false };
+
+        HashMap<uint64_t, JSC::WarmUpTier, DefaultHash<uint64_t>, WTF::UnsignedWithZeroKeyHashTraits<uint64_t>> m_warmUpTiers;
+        MonotonicTime m_firstCodeBlockTime;
+        MonotonicTime m_lastTierUpTime;
+        bool m_warmUpProfileLoaded { false };
+        bool m_warmUpProfileChanged { false };
+        bool m_hadWarmUpProfile { false };
+    };
+};
+
+} // namespace WebCore
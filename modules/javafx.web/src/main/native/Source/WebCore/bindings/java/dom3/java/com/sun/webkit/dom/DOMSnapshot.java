@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.dom;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Arrays;
+
+/**
+ * A read-only copy of a DOM subtree taken by {@link NodeImpl#snapshot}.
+ * Nodes are numbered in document order starting with the snapshot root,
+ * which has index 0 and no parent.
+ */
+public final class DOMSnapshot {
+    private static final int VERSION = 1;
+    private static final int FLAG_LAYOUT = 1;
+
+    private final String[] strings;
+    private final short[] nodeTypes;
+    private final int[] parents;
+    private final int[] names;
+    private final int[] values;
+    private final int[] attributeOffsets;
+    private final int[] attributes;
+    private final float[] boxes;
+
+    DOMSnapshot(byte[] data) {
+        ByteBuffer buffer = ByteBuffer.wrap(data).order(ByteOrder.nativeOrder());
+        int version = buffer.getInt();
+        if (version != VERSION) {
+            throw new IllegalStateException("Unsupported snapshot version " + version);
+        }
+        int flags = buffer.getInt();
+        int nodeCount = buffer.getInt();
+        int stringCount = buffer.getInt();
+
+        strings = new String[stringCount];
+        for (int i = 0; i < stringCount; i++) {
+            char[] chars = new char[buffer.getInt()];
+            buffer.asCharBuffer().get(chars);
+            buffer.position(buffer.position() + 2 * chars.length);
+            strings[i] = new String(chars);
+        }
+
+        nodeTypes = new short[nodeCount];
+        parents = new int[nodeCount];
+        names = new int[nodeCount];
+        values = new int[nodeCount];
+        attributeOffsets = new int[nodeCount + 1];
+        boxes = (flags & FLAG_LAYOUT) != 0 ? new float[4 * nodeCount] : null;
+
+        int[] attributeData = new int[16];
+        int attributeLength = 0;
+        for (int i = 0; i < nodeCount; i++) {
+            nodeTypes[i] = (short) buffer.getInt();
+            parents[i] = buffer.getInt();
+            names[i] = buffer.getInt();
+            values[i] = buffer.getInt();
+            int attributeCount = buffer.getInt();
+            attributeOffsets[i] = attributeLength / 2;
+            if (attributeLength + 2 * attributeCount > attributeData.length) {
+                attributeData = Arrays.copyOf(attributeData,
+                        Math.max(2 * attributeData.length, attributeLength + 2 * attributeCount));
+            }
+            for (int j = 0; j < 2 * attributeCount; j++) {
+                attributeData[attributeLength++] = buffer.getInt();
+            }
+            if (boxes != null) {
+                for (int j = 0; j < 4; j++) {
+                    boxes[4 * i + j] = buffer.getFloat();
+                }
+            }
+        }
+        attributeOffsets[nodeCount] = attributeLength / 2;
+        attributes = Arrays.copyOf(attributeData, attributeLength);
+    }
+
+    private String string(int index) {
+        return index < 0 ? null : strings[index];
+    }
+
+    public int getNodeCount() {
+        return nodeTypes.length;
+    }
+
+    /**
+     * Returns the DOM node type constant of a node.
+     */
+    public short getNodeType(int node) {
+        return nodeTypes[node];
+    }
+
+    /**
+     * Returns the index of the parent of a node, or -1 for the root.
+     */
+    public int getParent(int node) {
+        return parents[node];
+    }
+
+    /**
+     * Returns the tag name of an element or the node name of other nodes.
+     */
+    public String getNodeName(int node) {
+        return string(names[node]);
+    }
+
+    /**
+     * Returns the node value, which is null for elements and documents.
+     */
+    public String getNodeValue(int node) {
+        return string(values[node]);
+    }
+
+    public int getAttributeCount(int node) {
+        return attributeOffsets[node + 1] - attributeOffsets[node];
+    }
+
+    public String getAttributeName(int node, int attribute) {
+        return string(attributes[2 * (attributeOffsets[node] + attribute)]);
+    }
+
+    public String getAttributeValue(int node, int attribute) {
+        return string(attributes[2 * (attributeOffsets[node] + attribute) + 1]);
+    }
+
+    /**
+     * Returns whether the snapshot was taken with layout boxes.
+     */
+    public boolean hasLayout() {
+        return boxes != null;
+    }
+
+    /**
+     * Returns the absolute bounding box of a node as {@code x, y, width,
+     * height}, or null if the node is not rendered or the snapshot was taken
+     * without layout.
+     */
+    public float[] getBounds(int node) {
+        if (boxes == null || Float.isNaN(boxes[4 * node])) {
+            return null;
+        }
+        return new float[] {
+            boxes[4 * node], boxes[4 * node + 1], boxes[4 * node + 2], boxes[4 * node + 3]
+        };
+    }
+}
@@ -542,6 +542,40 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
         , long event);
 
 
+// Bulk access
+    /**
+     * Serializes this node and its descendants in a single native call.
+     *
+     * @param includeLayout whether to lay out the document and record the
+     *        absolute bounding box of every rendered node
+     */
+    public DOMSnapshot snapshot(boolean includeLayout)
+    {
+        return new DOMSnapshot(snapshotImpl(getPeer()
+            , includeLayout));
+    }
+    native static byte[] snapshotImpl(long peer
+        , boolean includeLayout);
+
+
+    /**
+     * Evaluates {@code querySelectorAll} on this element, document or
+     * document fragment and returns the matching nodes in one call.
+     */
+    public Node[] querySelectorAllNodes(String selectors) throws DOMException
+    {
+        long[] peers = querySelectorAllPeersImpl(getPeer()
+            , selectors);
+        Node[] nodes = new Node[peers.length];
+        for (int i = 0; i < peers.length; i++) {
+            nodes[i] = getImpl(peers[i]);
+        }
+        return nodes;
+    }
+    native static long[] querySelectorAllPeersImpl(long peer
+        , String selectors);
+
+
 
 //stubs
     public Object getUserData(String key) {
@@ -31,6 +31,10 @@
 #include "CachedScriptFetcher.h"
 #include <JavaScriptCore/SourceProvider.h>
 
+#if PLATFORM(JAVA)
+#include "BytecodeCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class CachedScriptSourceProvider : public JSC::SourceProvider, public CachedResourceClient {
@@ -40,12 +44,24 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(JAVA)
+        m_bytecodeCache.finish();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
     unsigned hash() const override { return m_cachedScript->scriptHash(); }
     StringView source() const override { return m_cachedScript->script(); }
 
+#if PLATFORM(JAVA)
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const override { return m_bytecodeCache.cachedBytecode(*this); }
+    void cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const override { m_bytecodeCache.cacheBytecode(*this, generator); }
+    void updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const override { m_bytecodeCache.updateCache(executable, kind, codeBlock); }
+    void commitCachedBytecode() const override { m_bytecodeCache.commit(); }
+    JSC::WarmUpTier warmUpTier(unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind kind) const override { return m_bytecodeCache.warmUpTier(*this, startOffset, endOffset, kind); }
+    void didTierUp(unsigned startOffset, unsigned endOffset, JSC::CodeSpecializationKind kind, JSC::WarmUpTier tier) const override { m_bytecodeCache.didTierUp(startOffset, endOffset, kind, tier); }
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), TextPosition(), sourceType)
@@ -55,6 +71,9 @@ private:
     }
 
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    mutable BytecodeCacheJava::Entry m_bytecodeCache;
+#endif
 };
 
 } // namespace WebCore
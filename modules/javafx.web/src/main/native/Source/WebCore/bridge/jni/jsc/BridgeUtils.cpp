@@ -38,6 +38,7 @@
 #include "JNIUtilityPrivate.h"
 #include "JSDOMBinding.h"
 #include "JSDOMGlobalObject.h"
+#include "JSDataCodec.h"
 #include "JSExecState.h"
 #include "JSNode.h"
 #include "ScriptController.h"
@@ -488,6 +489,145 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_callImpl
     return WebCore::JSValue_to_Java_Object(result, env, ctx, rootObject.get());
 }
 
+static JSValueRef decodeJSData(
+    JNIEnv* env,
+    JSContextRef ctx,
+    jbyteArray data,
+    jobjectArray buffers,
+    JSValueRef* exception)
+{
+    jsize length = env->GetArrayLength(data);
+    jbyte* bytes = env->GetByteArrayElements(data, nullptr);
+    if (!bytes) {
+        *exception = nullptr;
+        return nullptr;
+    }
+    JSValueRef value = WebCore::JSData::decode(env, ctx,
+        reinterpret_cast<const uint8_t*>(bytes), length, buffers, exception);
+    env->ReleaseByteArrayElements(data, bytes, JNI_ABORT);
+    return value;
+}
+
+static jbyteArray encodeJSData(
+    JNIEnv* env,
+    JSContextRef ctx,
+    JSValueRef value,
+    JSValueRef* exception)
+{
+    Vector<uint8_t> buffer;
+    if (!WebCore::JSData::encode(ctx, value, buffer, exception))
+        return nullptr;
+    jbyteArray result = env->NewByteArray(buffer.size());
+    if (result) {
+        env->SetByteArrayRegion(result, 0, buffer.size(),
+            reinterpret_cast<const jbyte*>(buffer.data()));
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setMemberDataImpl
+(JNIEnv *env, jclass, jlong peer, jint peer_type, jstring str, jbyteArray data, jobjectArray buffers)
+{
+    if (str == nullptr || data == nullptr) {
+        throwNullPointerException(env);
+        return;
+    }
+    JSObjectRef object;
+    JSContextRef ctx;
+    RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
+    if (rootObject.get() == nullptr) {
+        throwNullPointerException(env);
+        return;
+    }
+    JSValueRef exception = 0;
+    JSValueRef jsvalue = decodeJSData(env, ctx, data, buffers, &exception);
+    if (jsvalue) {
+        JSStringRef name = WebCore::asJSStringRef(env, str);
+        JSObjectSetProperty(ctx, object, name, jsvalue, 0, &exception);
+        JSStringRelease(name);
+    }
+    if (exception)
+        WebCore::throwJavaException(env, ctx, exception, rootObject.get());
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_dom_JSObject_getMemberDataImpl
+(JNIEnv *env, jclass, jlong peer, jint peer_type, jstring str)
+{
+    if (str == nullptr) {
+        throwNullPointerException(env);
+        return nullptr;
+    }
+    JSObjectRef object;
+    JSContextRef ctx;
+    RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
+    if (rootObject.get() == nullptr) {
+        throwNullPointerException(env);
+        return nullptr;
+    }
+    JSStringRef name = WebCore::asJSStringRef(env, str);
+    JSValueRef exception = 0;
+    JSValueRef value = JSObjectGetProperty(ctx, object, name, &exception);
+    JSStringRelease(name);
+    jbyteArray result = exception ? nullptr : encodeJSData(env, ctx, value, &exception);
+    if (exception) {
+        WebCore::throwJavaException(env, ctx, exception, rootObject.get());
+        return nullptr;
+    }
+    return result;
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_dom_JSObject_callDataImpl
+  (JNIEnv *env, jclass, jlong peer, jint peer_type, jstring methodName, jbyteArray args, jobjectArray buffers)
+{
+    if (methodName == nullptr || args == nullptr) {
+        throwNullPointerException(env);
+        return nullptr;
+    }
+    JSObjectRef object;
+    JSContextRef ctx;
+    RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
+    if (!rootObject || !rootObject.get() || !ctx) {
+        env->ThrowNew(getJSExceptionClass(env), "Invalid function reference");
+        return nullptr;
+    }
+
+    JSValueRef exception = 0;
+    JSValueRef result = JSValueMakeUndefined(ctx);
+    JSStringRef name = WebCore::asJSStringRef(env, methodName);
+    JSValueRef member = JSObjectGetProperty(ctx, object, name, nullptr);
+    JSStringRelease(name);
+    JSObjectRef function = JSValueIsObject(ctx, member) ? JSValueToObject(ctx, member, nullptr) : nullptr;
+    if (function && JSObjectIsFunction(ctx, function)) {
+        // The arguments arrive encoded as a single array; the array keeps its
+        // elements alive while they are passed on.
+        JSC::JSGlobalObject* globalObject = toJS(ctx);
+        JSC::JSLockHolder lock(globalObject);
+        JSValueRef argumentArray = decodeJSData(env, ctx, args, buffers, &exception);
+        if (!argumentArray && !exception)
+            return nullptr;
+        if (argumentArray && !JSC::isJSArray(toJS(globalObject, argumentArray))) {
+            env->ThrowNew(getJSExceptionClass(env), "Arguments must be encoded as an array");
+            return nullptr;
+        }
+        if (argumentArray) {
+            JSObjectRef array = const_cast<JSObjectRef>(argumentArray);
+            size_t argumentCount = JSC::asArray(toJS(globalObject, argumentArray))->length();
+            Vector<JSValueRef, 8> arguments(argumentCount);
+            for (size_t i = 0; i < argumentCount; i++)
+                arguments[i] = JSObjectGetPropertyAtIndex(ctx, array, i, nullptr);
+            result = JSObjectCallAsFunction(ctx, function, object,
+                                            argumentCount, arguments.data(),
+                                            &exception);
+        }
+    }
+    jbyteArray encoded = exception ? nullptr : encodeJSData(env, ctx, result, &exception);
+    if (exception) {
+        WebCore::throwJavaException(env, ctx, exception, rootObject.get());
+        return nullptr;
+    }
+    return encoded;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_unprotectImpl
 (JNIEnv*, jclass, jlong peer, jint peer_type)
 {
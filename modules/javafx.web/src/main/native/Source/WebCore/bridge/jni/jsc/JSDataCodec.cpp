@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "JSDataCodec.h"
+
+#include <JavaScriptCore/APICast.h>
+#include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
+#include <JavaScriptCore/JSArrayBufferView.h>
+#include <JavaScriptCore/JSCInlines.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/JSStringRef.h>
+#include <JavaScriptCore/JSTypedArray.h>
+#include <JavaScriptCore/ObjectConstructor.h>
+#include <JavaScriptCore/OpaqueJSString.h>
+#include <JavaScriptCore/TypedArrayType.h>
+#include <wtf/java/JavaRef.h>
+
+namespace WebCore {
+
+namespace JSData {
+
+namespace {
+
+// Deep enough for any reasonable payload, shallow enough to stay well clear
+// of the native stack limit. Cyclic structures run into it as well.
+constexpr unsigned maxDepth = 512;
+
+#define ASSERT_KIND(name) \
+    static_assert(static_cast<unsigned>(Kind::name) == static_cast<unsigned>(JSC::Type ## name) - JSC::TypeInt8, "");
+FOR_EACH_TYPED_ARRAY_TYPE_EXCLUDING_DATA_VIEW(ASSERT_KIND)
+#undef ASSERT_KIND
+
+JSTypedArrayType apiTypeForKind(Kind kind)
+{
+    switch (kind) {
+    case Kind::Int8:
+        return kJSTypedArrayTypeInt8Array;
+    case Kind::Uint8:
+        return kJSTypedArrayTypeUint8Array;
+    case Kind::Uint8Clamped:
+        return kJSTypedArrayTypeUint8ClampedArray;
+    case Kind::Int16:
+        return kJSTypedArrayTypeInt16Array;
+    case Kind::Uint16:
+        return kJSTypedArrayTypeUint16Array;
+    case Kind::Int32:
+        return kJSTypedArrayTypeInt32Array;
+    case Kind::Uint32:
+        return kJSTypedArrayTypeUint32Array;
+    case Kind::Float32:
+        return kJSTypedArrayTypeFloat32Array;
+    case Kind::Float64:
+        return kJSTypedArrayTypeFloat64Array;
+    case Kind::BigInt64:
+        return kJSTypedArrayTypeBigInt64Array;
+    case Kind::BigUint64:
+        return kJSTypedArrayTypeBigUint64Array;
+    }
+    return kJSTypedArrayTypeNone;
+}
+
+JSValueRef makeError(JSContextRef ctx, const char* message)
+{
+    JSStringRef string = JSStringCreateWithUTF8CString(message);
+    JSValueRef argument = JSValueMakeString(ctx, string);
+    JSStringRelease(string);
+    return JSObjectMakeError(ctx, 1, &argument, nullptr);
+}
+
+void freeBytes(void* bytes, void*)
+{
+    fastFree(bytes);
+}
+
+class Decoder {
+public:
+    Decoder(JNIEnv* env, JSContextRef ctx, const uint8_t* data, size_t length, jobjectArray buffers)
+        : m_env(env)
+        , m_ctx(ctx)
+        , m_globalObject(toJS(ctx))
+        , m_data(data)
+        , m_length(length)
+        , m_buffers(buffers)
+    {
+    }
+
+    JSValueRef decode(JSValueRef* exception)
+    {
+        int32_t bufferVersion;
+        if (!read(bufferVersion) || bufferVersion != version)
+            return malformed(exception);
+        JSValueRef value = decodeValue(0, exception);
+        if (value && m_position != m_length)
+            return malformed(exception);
+        return value;
+    }
+
+private:
+    template<typename T> bool read(T& value)
+    {
+        if (m_length - m_position < sizeof(T))
+            return false;
+        memcpy(&value, m_data + m_position, sizeof(T));
+        m_position += sizeof(T);
+        return true;
+    }
+
+    const uint8_t* readBytes(size_t count)
+    {
+        if (m_length - m_position < count)
+            return nullptr;
+        const uint8_t* bytes = m_data + m_position;
+        m_position += count;
+        return bytes;
+    }
+
+    bool readCount(size_t& count)
+    {
+        int32_t value;
+        if (!read(value) || value < 0)
+            return false;
+        count = value;
+        return true;
+    }
+
+    RefPtr<OpaqueJSString> readString()
+    {
+        size_t length;
+        if (!readCount(length) || length > (m_length - m_position) / sizeof(UChar))
+            return nullptr;
+        const uint8_t* bytes = readBytes(length * sizeof(UChar));
+        UChar* characters;
+        auto string = StringImpl::createUninitialized(static_cast<unsigned>(length), characters);
+        memcpy(characters, bytes, length * sizeof(UChar));
+        return OpaqueJSString::tryCreate(String(WTFMove(string)));
+    }
+
+    JSValueRef malformed(JSValueRef* exception)
+    {
+        *exception = makeError(m_ctx, "Malformed JSData buffer");
+        return nullptr;
+    }
+
+    bool takeException(JSC::CatchScope& scope, JSValueRef* exception)
+    {
+        JSC::Exception* thrown = scope.exception();
+        if (LIKELY(!thrown))
+            return false;
+        *exception = toRef(m_globalObject, thrown->value());
+        scope.clearException();
+        return true;
+    }
+
+    JSValueRef makeArrayBuffer(const void* bytes, size_t byteLength, JSValueRef* exception)
+    {
+        void* copy = fastMalloc(byteLength ? byteLength : 1);
+        memcpy(copy, bytes, byteLength);
+        return JSObjectMakeArrayBufferWithBytesNoCopy(m_ctx, copy, byteLength, freeBytes, nullptr, exception);
+    }
+
+    JSValueRef decodeValue(unsigned depth, JSValueRef* exception)
+    {
+        uint8_t tag;
+        if (depth > maxDepth || !read(tag))
+            return malformed(exception);
+
+        switch (static_cast<Tag>(tag)) {
+        case Tag::Undefined:
+            return JSValueMakeUndefined(m_ctx);
+        case Tag::Null:
+            return JSValueMakeNull(m_ctx);
+        case Tag::False:
+            return JSValueMakeBoolean(m_ctx, false);
+        case Tag::True:
+            return JSValueMakeBoolean(m_ctx, true);
+        case Tag::Int32: {
+            int32_t value;
+            if (!read(value))
+                return malformed(exception);
+            return JSValueMakeNumber(m_ctx, value);
+        }
+        case Tag::Double: {
+            double value;
+            if (!read(value))
+                return malformed(exception);
+            return JSValueMakeNumber(m_ctx, value);
+        }
+        case Tag::String: {
+            auto string = readString();
+            if (!string)
+                return malformed(exception);
+            return JSValueMakeString(m_ctx, string.get());
+        }
+        // Arrays and objects get own data properties, as with JSON.parse. A [[Set]] would let a
+        // "__proto__" key replace the prototype and run setters the page defined on the prototypes.
+        case Tag::Array: {
+            size_t count;
+            if (!readCount(count))
+                return malformed(exception);
+            JSC::VM& vm = m_globalObject->vm();
+            auto scope = DECLARE_CATCH_SCOPE(vm);
+            JSC::JSArray* array = JSC::constructEmptyArray(m_globalObject, nullptr);
+            if (takeException(scope, exception))
+                return nullptr;
+            for (size_t i = 0; i < count; ++i) {
+                JSValueRef element = decodeValue(depth + 1, exception);
+                if (!element)
+                    return nullptr;
+                array->putDirectIndex(m_globalObject, static_cast<unsigned>(i), toJS(m_globalObject, element));
+                if (takeException(scope, exception))
+                    return nullptr;
+            }
+            return toRef(array);
+        }
+        case Tag::Object: {
+            size_t count;
+            if (!readCount(count))
+                return malformed(exception);
+            JSC::VM& vm = m_globalObject->vm();
+            auto scope = DECLARE_CATCH_SCOPE(vm);
+            JSC::JSObject* object = JSC::constructEmptyObject(m_globalObject);
+            for (size_t i = 0; i < count; ++i) {
+                auto key = readString();
+                if (!key)
+                    return malformed(exception);
+                JSValueRef value = decodeValue(depth + 1, exception);
+                if (!value)
+                    return nullptr;
+                auto name = JSC::Identifier::fromString(vm, key->string());
+                if (auto index = JSC::parseIndex(name))
+                    object->putDirectIndex(m_globalObject, *index, toJS(m_globalObject, value));
+                else
+                    object->putDirect(vm, name, toJS(m_globalObject, value));
+                if (takeException(scope, exception))
+                    return nullptr;
+            }
+            return toRef(object);
+        }
+        case Tag::ArrayBuffer: {
+            size_t byteLength;
+            const uint8_t* bytes;
+            if (!readCount(byteLength) || !(bytes = readBytes(byteLength)))
+                return malformed(exception);
+            return makeArrayBuffer(bytes, byteLength, exception);
+        }
+        case Tag::TypedArray: {
+            uint8_t kind;
+            size_t count;
+            if (!read(kind) || kind > static_cast<uint8_t>(Kind::BigUint64) || !readCount(count))
+                return malformed(exception);
+            size_t elementSize = JSC::elementSize(static_cast<JSC::TypedArrayType>(JSC::TypeInt8 + kind));
+            if (count > (m_length - m_position) / elementSize)
+                return malformed(exception);
+            size_t byteLength = count * elementSize;
+            const uint8_t* bytes = readBytes(byteLength);
+            void* copy = fastMalloc(byteLength ? byteLength : 1);
+            memcpy(copy, bytes, byteLength);
+            return JSObjectMakeTypedArrayWithBytesNoCopy(m_ctx, apiTypeForKind(static_cast<Kind>(kind)),
+                copy, byteLength, freeBytes, nullptr, exception);
+        }
+        case Tag::DirectBuffer: {
+            int32_t index, offset, byteLength;
+            if (!read(index) || !read(offset) || !read(byteLength) || !m_buffers
+                || index < 0 || index >= m_env->GetArrayLength(m_buffers) || offset < 0 || byteLength < 0)
+                return malformed(exception);
+            JLObject buffer(m_env->GetObjectArrayElement(m_buffers, index));
+            auto* address = static_cast<const uint8_t*>(m_env->GetDirectBufferAddress(buffer));
+            jlong capacity = m_env->GetDirectBufferCapacity(buffer);
+            if (!address || static_cast<jlong>(offset) + byteLength > capacity)
+                return malformed(exception);
+            return makeArrayBuffer(address + offset, byteLength, exception);
+        }
+        }
+        return malformed(exception);
+    }
+
+    JNIEnv* m_env;
+    JSContextRef m_ctx;
+    JSC::JSGlobalObject* m_globalObject;
+    const uint8_t* m_data;
+    size_t m_length;
+    size_t m_position { 0 };
+    jobjectArray m_buffers;
+};
+
+class Encoder {
+public:
+    Encoder(JSContextRef ctx, Vector<uint8_t>& buffer)
+        : m_ctx(ctx)
+        , m_globalObject(toJS(ctx))
+        , m_buffer(buffer)
+    {
+    }
+
+    bool encode(JSValueRef value, JSValueRef* exception)
+    {
+        append(version);
+        return encodeValue(value, 0, exception);
+    }
+
+private:
+    template<typename T> void append(T value)
+    {
+        m_buffer.append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    void appendTag(Tag tag)
+    {
+        append(static_cast<uint8_t>(tag));
+    }
+
+    void appendString(JSStringRef string)
+    {
+        size_t length = JSStringGetLength(string);
+        append(static_cast<int32_t>(length));
+        m_buffer.append(reinterpret_cast<const uint8_t*>(JSStringGetCharactersPtr(string)), length * sizeof(UChar));
+    }
+
+    void appendBytes(Tag tag, const void* bytes, size_t byteLength)
+    {
+        appendTag(tag);
+        append(static_cast<int32_t>(byteLength));
+        m_buffer.append(static_cast<const uint8_t*>(bytes), byteLength);
+    }
+
+    bool encodeValue(JSValueRef value, unsigned depth, JSValueRef* exception)
+    {
+        if (depth > maxDepth) {
+            *exception = makeError(m_ctx, "Value is nested too deeply or cyclic");
+            return false;
+        }
+
+        JSC::VM& vm = m_globalObject->vm();
+        JSC::JSValue jsValue = toJS(m_globalObject, value);
+        if (jsValue.isUndefined())
+            appendTag(Tag::Undefined);
+        else if (jsValue.isNull())
+            appendTag(Tag::Null);
+        else if (jsValue.isBoolean())
+            appendTag(jsValue.asBoolean() ? Tag::True : Tag::False);
+        else if (jsValue.isInt32()) {
+            appendTag(Tag::Int32);
+            append(jsValue.asInt32());
+        } else if (jsValue.isNumber()) {
+            appendTag(Tag::Double);
+            append(jsValue.asNumber());
+        } else if (jsValue.isString()) {
+            JSStringRef string = JSValueToStringCopy(m_ctx, value, exception);
+            if (!string)
+                return false;
+            appendTag(Tag::String);
+            appendString(string);
+            JSStringRelease(string);
+        } else if (!jsValue.isObject())
+            appendTag(Tag::Undefined);
+        else if (auto* arrayBuffer = JSC::jsDynamicCast<JSC::JSArrayBuffer*>(vm, jsValue)) {
+            auto* impl = arrayBuffer->impl();
+            appendBytes(Tag::ArrayBuffer, impl->data(), impl->byteLength());
+        } else if (auto* view = JSC::jsDynamicCast<JSC::JSArrayBufferView*>(vm, jsValue)) {
+            JSC::TypedArrayType type = JSC::typedArrayTypeForType(view->type());
+            size_t byteLength = view->isDetached() ? 0 : view->byteLength();
+            if (type == JSC::TypeDataView)
+                appendBytes(Tag::ArrayBuffer, view->vector(), byteLength);
+            else {
+                appendTag(Tag::TypedArray);
+                append(static_cast<uint8_t>(type - JSC::TypeInt8));
+                append(static_cast<int32_t>(view->isDetached() ? 0 : view->length()));
+                m_buffer.append(static_cast<const uint8_t*>(view->vector()), byteLength);
+            }
+        } else if (JSC::isJSArray(jsValue)) {
+            JSObjectRef array = const_cast<JSObjectRef>(value);
+            unsigned length = JSC::asArray(jsValue)->length();
+            appendTag(Tag::Array);
+            append(static_cast<int32_t>(length));
+            for (unsigned i = 0; i < length; ++i) {
+                JSValueRef element = JSObjectGetPropertyAtIndex(m_ctx, array, i, exception);
+                if (*exception || !encodeValue(element, depth + 1, exception))
+                    return false;
+            }
+        } else {
+            JSObjectRef object = const_cast<JSObjectRef>(value);
+            if (JSObjectIsFunction(m_ctx, object)) {
+                appendTag(Tag::Undefined);
+                return true;
+            }
+            JSPropertyNameArrayRef names = JSObjectCopyPropertyNames(m_ctx, object);
+            size_t count = JSPropertyNameArrayGetCount(names);
+            appendTag(Tag::Object);
+            append(static_cast<int32_t>(count));
+            bool succeeded = true;
+            for (size_t i = 0; succeeded && i < count; ++i) {
+                JSStringRef name = JSPropertyNameArrayGetNameAtIndex(names, i);
+                appendString(name);
+                JSValueRef property = JSObjectGetProperty(m_ctx, object, name, exception);
+                succeeded = !*exception && encodeValue(property, depth + 1, exception);
+            }
+            JSPropertyNameArrayRelease(names);
+            return succeeded;
+        }
+        return true;
+    }
+
+    JSContextRef m_ctx;
+    JSC::JSGlobalObject* m_globalObject;
+    Vector<uint8_t>& m_buffer;
+};
+
+} // namespace
+
+JSValueRef decode(JNIEnv* env, JSContextRef ctx, const uint8_t* data, size_t length, jobjectArray buffers, JSValueRef* exception)
+{
+    JSC::JSLockHolder lock(toJS(ctx));
+    *exception = nullptr;
+    return Decoder(env, ctx, data, length, buffers).decode(exception);
+}
+
+bool encode(JSContextRef ctx, JSValueRef value, Vector<uint8_t>& buffer, JSValueRef* exception)
+{
+    JSC::JSLockHolder lock(toJS(ctx));
+    *exception = nullptr;
+    return Encoder(ctx, buffer).encode(value, exception);
+}
+
+} // namespace JSData
+
+} // namespace WebCore
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/JSObjectRef.h>
+#include <jni.h>
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+// Structured values exchanged in bulk with com.sun.webkit.dom.JSData. A
+// buffer starts with a native endian int32 version followed by one value:
+//
+//   undefined, null, false, true:  tag
+//   int32, double:                 tag, value
+//   string:                        tag, length, length UTF-16 code units
+//   array:                         tag, count, count values
+//   object:                        tag, count, count times { key string, value }
+//   ArrayBuffer:                   tag, byteLength, bytes
+//   typed array:                   tag, kind, element count, bytes
+//   direct ByteBuffer:             tag, index, offset, byteLength
+//
+// Tags and typed array kinds are single bytes, all other integers are native
+// endian int32. Key strings are encoded like string values without the tag.
+// Direct ByteBuffer entries are only written by Java and refer to an element
+// of the buffer array passed alongside the encoded bytes, so large binary
+// payloads are copied once into their ArrayBuffer instead of through the
+// encoded stream.
+namespace JSData {
+
+constexpr int32_t version = 1;
+
+enum class Tag : uint8_t {
+    Undefined,
+    Null,
+    False,
+    True,
+    Int32,
+    Double,
+    String,
+    Array,
+    Object,
+    ArrayBuffer,
+    TypedArray,
+    DirectBuffer,
+};
+
+enum class Kind : uint8_t {
+    Int8,
+    Uint8,
+    Uint8Clamped,
+    Int16,
+    Uint16,
+    Int32,
+    Uint32,
+    Float32,
+    Float64,
+    BigInt64,
+    BigUint64,
+};
+
+// Materializes an encoded value. Returns nullptr and sets |exception| if the
+// buffer is malformed or a script exception is raised.
+JSValueRef decode(JNIEnv*, JSContextRef, const uint8_t* data, size_t length, jobjectArray buffers, JSValueRef* exception);
+
+// Encodes |value|. Functions and symbols become undefined. Returns false and
+// sets |exception| if a getter throws or the value nests too deeply, which
+// is also how cycles are reported.
+bool encode(JSContextRef, JSValueRef, Vector<uint8_t>&, JSValueRef* exception);
+
+} // namespace JSData
+
+} // namespace WebCore
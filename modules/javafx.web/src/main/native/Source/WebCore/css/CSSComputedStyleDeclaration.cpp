@@ -47,6 +47,7 @@
 #include "CSSTimingFunctionValue.h"
 #include "CSSValueList.h"
 #include "CSSValuePool.h"
+#include "CachedCSSStyleSheet.h"
 #include "ComposedTreeAncestorIterator.h"
 #include "ContentData.h"
 #include "CursorList.h"
@@ -2290,6 +2291,10 @@ static bool updateStyleIfNeededForProperty(Element& element, CSSPropertyID prope
 {
     auto& document = element.document();
 
+    // A sheet that has loaded but is still being tokenized must apply to the computed style.
+    if (!document.haveStylesheetsLoaded())
+        CachedCSSStyleSheet::finishBackgroundTokenization(document);
+
     document.styleScope().flushPendingUpdate();
 
     auto hasValidStyle = [&] {
@@ -24,6 +24,7 @@
 #include "CSSImportRule.h"
 #include "CSSParser.h"
 #include "CSSStyleSheet.h"
+#include "CSSTokenizer.h"
 #include "CachePolicy.h"
 #include "CachedCSSStyleSheet.h"
 #include "ContentRuleListResults.h"
@@ -339,6 +340,12 @@ bool StyleSheetContents::parseAuthorStyleSheet(const CachedCSSStyleSheet* cached
         return false;
     }
 
+    String tokenizedText;
+    if (auto tokenizer = cachedStyleSheet->takeBackgroundTokenizer(sheetText, tokenizedText)) {
+        CSSParser(parserContext()).parseSheet(*this, tokenizedText, CSSParser::RuleParsing::Deferred, WTFMove(tokenizer));
+        return true;
+    }
+
     CSSParser(parserContext()).parseSheet(*this, sheetText, CSSParser::RuleParsing::Deferred);
     return true;
 }
@@ -70,6 +70,11 @@ void CSSParser::parseSheet(StyleSheetContents& sheet, const String& string, Rule
     return CSSParserImpl::parseStyleSheet(string, m_context, sheet, ruleParsing);
 }
 
+void CSSParser::parseSheet(StyleSheetContents& sheet, const String& string, RuleParsing ruleParsing, std::unique_ptr<CSSTokenizer>&& tokenizer)
+{
+    return CSSParserImpl::parseStyleSheet(string, m_context, sheet, ruleParsing, WTFMove(tokenizer));
+}
+
 void CSSParser::parseSheetForInspector(const CSSParserContext& context, StyleSheetContents* sheet, const String& string, CSSParserObserver& observer)
 {
     return CSSParserImpl::parseStyleSheetForInspector(string, context, sheet, observer);
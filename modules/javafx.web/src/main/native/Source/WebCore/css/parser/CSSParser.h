@@ -33,6 +33,7 @@ namespace WebCore {
 
 class CSSParserObserver;
 class CSSSelectorList;
+class CSSTokenizer;
 class CSSValueList;
 class CSSValuePool;
 class Color;
@@ -65,6 +66,8 @@ public:
 
     enum class RuleParsing { Normal, Deferred };
     void parseSheet(StyleSheetContents&, const String&, RuleParsing = RuleParsing::Normal);
+    // Parses a sheet whose text was already tokenized, typically on a background thread.
+    void parseSheet(StyleSheetContents&, const String&, RuleParsing, std::unique_ptr<CSSTokenizer>&&);
 
     static RefPtr<StyleRuleBase> parseRule(const CSSParserContext&, StyleSheetContents*, const String&);
 
@@ -85,6 +85,17 @@ CSSParserImpl::CSSParserImpl(const CSSParserContext& context, const String& stri
         m_deferredParser = CSSDeferredParser::create(context, string, *styleSheet);
 }
 
+// |tokenizer| must have been created from |string|, which the deferred parser keeps alive for the tokens.
+CSSParserImpl::CSSParserImpl(const CSSParserContext& context, const String& string, StyleSheetContents& styleSheet, CSSParser::RuleParsing ruleParsing, std::unique_ptr<CSSTokenizer>&& tokenizer)
+    : m_context(context)
+    , m_styleSheet(&styleSheet)
+    , m_tokenizer(WTFMove(tokenizer))
+{
+    ASSERT(m_tokenizer);
+    if (context.deferredCSSParserEnabled && ruleParsing == CSSParser::RuleParsing::Deferred)
+        m_deferredParser = CSSDeferredParser::create(context, string, styleSheet);
+}
+
 CSSParser::ParseResult CSSParserImpl::parseValue(MutableStyleProperties* declaration, CSSPropertyID propertyID, const String& string, bool important, const CSSParserContext& context)
 {
     CSSParserImpl parser(context, string);
@@ -246,14 +257,25 @@ RefPtr<StyleRuleBase> CSSParserImpl::parseRule(const String& string, const CSSPa
 void CSSParserImpl::parseStyleSheet(const String& string, const CSSParserContext& context, StyleSheetContents& styleSheet, CSSParser::RuleParsing ruleParsing)
 {
     CSSParserImpl parser(context, string, &styleSheet, nullptr, ruleParsing);
-    bool firstRuleValid = parser.consumeRuleList(parser.tokenizer()->tokenRange(), TopLevelRuleList, [&styleSheet](RefPtr<StyleRuleBase> rule) {
+    parser.consumeStyleSheet(styleSheet);
+}
+
+void CSSParserImpl::parseStyleSheet(const String& string, const CSSParserContext& context, StyleSheetContents& styleSheet, CSSParser::RuleParsing ruleParsing, std::unique_ptr<CSSTokenizer>&& tokenizer)
+{
+    CSSParserImpl parser(context, string, styleSheet, ruleParsing, WTFMove(tokenizer));
+    parser.consumeStyleSheet(styleSheet);
+}
+
+void CSSParserImpl::consumeStyleSheet(StyleSheetContents& styleSheet)
+{
+    bool firstRuleValid = consumeRuleList(m_tokenizer->tokenRange(), TopLevelRuleList, [&styleSheet](RefPtr<StyleRuleBase> rule) {
         if (rule->isCharsetRule())
             return;
         styleSheet.parserAppendRule(rule.releaseNonNull());
     });
     styleSheet.setHasSyntacticallyValidCSSHeader(firstRuleValid);
     styleSheet.shrinkToFit();
-    parser.adoptTokenizerEscapedStrings();
+    adoptTokenizerEscapedStrings();
 }
 
 void CSSParserImpl::adoptTokenizerEscapedStrings()
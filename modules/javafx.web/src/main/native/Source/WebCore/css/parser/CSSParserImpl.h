@@ -91,6 +91,7 @@ public:
     static bool parseDeclarationList(MutableStyleProperties*, const String&, const CSSParserContext&);
     static RefPtr<StyleRuleBase> parseRule(const String&, const CSSParserContext&, StyleSheetContents*, AllowedRulesType);
     static void parseStyleSheet(const String&, const CSSParserContext&, StyleSheetContents&, CSSParser::RuleParsing);
+    static void parseStyleSheet(const String&, const CSSParserContext&, StyleSheetContents&, CSSParser::RuleParsing, std::unique_ptr<CSSTokenizer>&&);
     static CSSSelectorList parsePageSelector(CSSParserTokenRange, StyleSheetContents*);
 
     static Vector<double> parseKeyframeKeyList(const String&);
@@ -111,6 +112,9 @@ public:
 private:
     CSSParserImpl(const CSSParserContext&, StyleSheetContents*);
     CSSParserImpl(CSSDeferredParser&);
+    CSSParserImpl(const CSSParserContext&, const String&, StyleSheetContents&, CSSParser::RuleParsing, std::unique_ptr<CSSTokenizer>&&);
+
+    void consumeStyleSheet(StyleSheetContents&);
 
     enum RuleListType {
         TopLevelRuleList,
@@ -2252,6 +2252,10 @@ void Document::updateLayoutIgnorePendingStylesheets(Document::RunPostLayoutTasks
 {
     bool oldIgnore = m_ignorePendingStylesheets;
 
+    // Sheets that have loaded but are still being tokenized are applied rather than ignored.
+    if (!haveStylesheetsLoaded())
+        CachedCSSStyleSheet::finishBackgroundTokenization(*this);
+
     if (!haveStylesheetsLoaded()) {
         m_ignorePendingStylesheets = true;
         // FIXME: This should just invalidate elements with missing styles.
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "CompactHTMLToken.h"
 #include "HTMLToken.h"
 
 namespace WebCore {
@@ -33,6 +34,7 @@ namespace WebCore {
 class AtomHTMLToken {
 public:
     explicit AtomHTMLToken(HTMLToken&);
+    explicit AtomHTMLToken(CompactHTMLToken&);
     AtomHTMLToken(HTMLToken::Type, const AtomString& name, Vector<Attribute>&& = { }); // Only StartTag or EndTag.
 
     AtomHTMLToken(const AtomHTMLToken&) = delete;
@@ -72,7 +74,7 @@ public:
 private:
     HTMLToken::Type m_type;
 
-    void initializeAttributes(const HTMLToken::AttributeList& attributes);
+    template<typename AttributeList> void initializeAttributes(const AttributeList&);
 
     AtomString m_name; // StartTag, EndTag, DOCTYPE.
 
@@ -191,7 +193,7 @@ inline bool hasAttribute(const Vector<Attribute>& attributes, const AtomString&
     return false;
 }
 
-inline void AtomHTMLToken::initializeAttributes(const HTMLToken::AttributeList& attributes)
+template<typename AttributeList> inline void AtomHTMLToken::initializeAttributes(const AttributeList& attributes)
 {
     unsigned size = attributes.size();
     if (!size)
@@ -244,6 +246,41 @@ inline AtomHTMLToken::AtomHTMLToken(HTMLToken& token)
     ASSERT_NOT_REACHED();
 }
 
+// The characters of a Character token stay owned by the CompactHTMLToken, as they do for an HTMLToken.
+inline AtomHTMLToken::AtomHTMLToken(CompactHTMLToken& token)
+    : m_type(token.type())
+{
+    switch (m_type) {
+    case HTMLToken::Uninitialized:
+        ASSERT_NOT_REACHED();
+        return;
+    case HTMLToken::DOCTYPE:
+        m_name = AtomString(token.name());
+        m_doctypeData = token.releaseDoctypeData();
+        return;
+    case HTMLToken::EndOfFile:
+        return;
+    case HTMLToken::StartTag:
+    case HTMLToken::EndTag:
+        m_selfClosing = token.selfClosing();
+        m_name = AtomString(token.name());
+        initializeAttributes(token.attributes());
+        return;
+    case HTMLToken::Comment:
+        if (token.commentIsAll8BitData())
+            m_data = String::make8BitFrom16BitSource(token.comment());
+        else
+            m_data = String(token.comment());
+        return;
+    case HTMLToken::Character:
+        m_externalCharacters = token.characters().data();
+        m_externalCharactersLength = token.characters().size();
+        m_externalCharactersIsAll8BitData = token.charactersIsAll8BitData();
+        return;
+    }
+    ASSERT_NOT_REACHED();
+}
+
 inline AtomHTMLToken::AtomHTMLToken(HTMLToken::Type type, const AtomString& name, Vector<Attribute>&& attributes)
     : m_type(type)
     , m_name(name)
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BackgroundHTMLTokenizer.h"
+
+#include "HTMLDocumentParser.h"
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WorkQueue.h>
+
+namespace WebCore {
+
+// Tokens are handed to the main thread in batches of this size.
+static constexpr unsigned tokensPerBatch = 64;
+
+// The background thread stops once this many tokens are waiting for the tree builder,
+// for instance while a parser-blocking script loads, and resumes when half are consumed.
+static constexpr unsigned maximumOutstandingTokens = 4096;
+
+static WorkQueue& backgroundTokenizerQueue()
+{
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("WebCore HTML Tokenizer", WorkQueue::Type::Serial, WorkQueue::QOS::UserInitiated));
+    return queue.get();
+}
+
+Ref<BackgroundHTMLTokenizer> BackgroundHTMLTokenizer::create(HTMLDocumentParser& parser, const HTMLParserOptions& options, const HTMLTokenizer::Checkpoint& checkpoint, const String& source)
+{
+    ASSERT(isMainThread());
+    auto tokenizer = adoptRef(*new BackgroundHTMLTokenizer(parser, options, checkpoint));
+    tokenizer->append(source);
+    return tokenizer;
+}
+
+BackgroundHTMLTokenizer::BackgroundHTMLTokenizer(HTMLDocumentParser& parser, const HTMLParserOptions& options, const HTMLTokenizer::Checkpoint& checkpoint)
+    : m_parser(&parser)
+    , m_tokenizer(options)
+    , m_simulator(options, checkpoint.forceNullCharacterReplacement && !checkpoint.shouldAllowCDATA)
+{
+    m_tokenizer.restoreCheckpoint(checkpoint);
+}
+
+BackgroundHTMLTokenizer::~BackgroundHTMLTokenizer() = default;
+
+void BackgroundHTMLTokenizer::append(const String& source)
+{
+    ASSERT(isMainThread());
+    if (source.isEmpty())
+        return;
+    backgroundTokenizerQueue().dispatch([protectedThis = makeRef(*this), source = source.isolatedCopy()]() mutable {
+        protectedThis->m_source.append(WTFMove(source));
+        protectedThis->tokenize();
+    });
+}
+
+void BackgroundHTMLTokenizer::finish()
+{
+    ASSERT(isMainThread());
+    backgroundTokenizerQueue().dispatch([protectedThis = makeRef(*this)] {
+        // Matches HTMLInputStream::markEndOfFile().
+        protectedThis->m_source.append(String { &kEndOfFileMarker, 1 });
+        protectedThis->m_source.close();
+        protectedThis->tokenize();
+    });
+}
+
+void BackgroundHTMLTokenizer::stop()
+{
+    ASSERT(isMainThread());
+    m_parser = nullptr;
+    m_isStopped = true;
+}
+
+auto BackgroundHTMLTokenizer::takeTokens() -> Deque<SpeculativeToken>
+{
+    ASSERT(isMainThread());
+    Locker locker { m_lock };
+    m_hasPendingNotification = false;
+    return std::exchange(m_tokens, { });
+}
+
+void BackgroundHTMLTokenizer::didConsumeToken()
+{
+    ASSERT(isMainThread());
+    {
+        Locker locker { m_lock };
+        ASSERT(m_outstandingTokenCount);
+        --m_outstandingTokenCount;
+        if (!m_isWaitingForConsumer || m_outstandingTokenCount > maximumOutstandingTokens / 2)
+            return;
+        m_isWaitingForConsumer = false;
+    }
+    backgroundTokenizerQueue().dispatch([protectedThis = makeRef(*this)] {
+        protectedThis->tokenize();
+    });
+}
+
+void BackgroundHTMLTokenizer::tokenize()
+{
+    ASSERT(!isMainThread());
+
+    {
+        Locker locker { m_lock };
+        if (m_isWaitingForConsumer)
+            return;
+    }
+
+    Vector<SpeculativeToken> batch;
+    while (!m_isStopped) {
+        auto token = m_tokenizer.nextToken(m_source);
+        if (!token)
+            break;
+
+        CompactHTMLToken compactToken(*token);
+        token.clear();
+
+        unsigned sourceLength = m_source.numberOfCharactersConsumed();
+        auto checkpoint = m_tokenizer.checkpoint();
+        m_simulator.simulate(compactToken, m_tokenizer);
+        batch.append({ WTFMove(compactToken), sourceLength - m_sourceLengthAtLastToken, WTFMove(checkpoint), m_tokenizer.checkpoint() });
+        m_sourceLengthAtLastToken = sourceLength;
+
+        if (batch.size() == tokensPerBatch && !deliver(batch))
+            return;
+    }
+    deliver(batch);
+}
+
+bool BackgroundHTMLTokenizer::deliver(Vector<SpeculativeToken>& batch)
+{
+    ASSERT(!isMainThread());
+
+    bool shouldNotify = false;
+    bool shouldContinue = true;
+    {
+        Locker locker { m_lock };
+        m_outstandingTokenCount += batch.size();
+        for (auto& token : batch)
+            m_tokens.append(WTFMove(token));
+        if (!batch.isEmpty() && !m_hasPendingNotification)
+            m_hasPendingNotification = shouldNotify = true;
+        if (m_outstandingTokenCount >= maximumOutstandingTokens)
+            m_isWaitingForConsumer = true;
+        shouldContinue = !m_isWaitingForConsumer;
+    }
+    batch.clear();
+
+    if (shouldNotify) {
+        callOnMainThread([protectedThis = makeRef(*this)] {
+            if (auto* parser = protectedThis->m_parser)
+                parser->didReceiveSpeculativeTokens();
+        });
+    }
+    return shouldContinue;
+}
+
+} // namespace WebCore
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "CompactHTMLToken.h"
+#include "HTMLTokenizer.h"
+#include "HTMLTreeBuilderSimulator.h"
+#include "SegmentedString.h"
+#include <wtf/Deque.h>
+#include <wtf/Lock.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+namespace WebCore {
+
+class HTMLDocumentParser;
+
+// Tokenizes a copy of the document source on a background thread, ahead of the tree
+// builder. Between tokens the tokenizer state is predicted by an HTMLTreeBuilderSimulator;
+// HTMLDocumentParser replays the tokens on the main thread and abandons the speculation
+// as soon as the real tree builder disagrees or document.write() changes the input.
+class BackgroundHTMLTokenizer : public ThreadSafeRefCounted<BackgroundHTMLTokenizer> {
+public:
+    struct SpeculativeToken {
+        CompactHTMLToken token;
+        // Number of source characters consumed since the previous token ended.
+        unsigned sourceLength;
+        // The tokenizer state right after |token| was produced, and the state predicted
+        // once the tree builder has processed it.
+        HTMLTokenizer::Checkpoint checkpoint;
+        HTMLTokenizer::Checkpoint predictedCheckpoint;
+    };
+
+    // |source| is the unconsumed input, starting where |checkpoint| was taken.
+    static Ref<BackgroundHTMLTokenizer> create(HTMLDocumentParser&, const HTMLParserOptions&, const HTMLTokenizer::Checkpoint&, const String& source);
+    ~BackgroundHTMLTokenizer();
+
+    // Everything below is called on the main thread.
+    void append(const String&);
+    void finish();
+    void stop();
+
+    Deque<SpeculativeToken> takeTokens();
+    void didConsumeToken();
+
+private:
+    BackgroundHTMLTokenizer(HTMLDocumentParser&, const HTMLParserOptions&, const HTMLTokenizer::Checkpoint&);
+
+    void tokenize();
+    bool deliver(Vector<SpeculativeToken>&);
+
+    // Main thread only. Cleared by stop().
+    HTMLDocumentParser* m_parser;
+
+    // Background thread only.
+    SegmentedString m_source;
+    HTMLTokenizer m_tokenizer;
+    HTMLTreeBuilderSimulator m_simulator;
+    unsigned m_sourceLengthAtLastToken { 0 };
+
+    std::atomic<bool> m_isStopped { false };
+
+    Lock m_lock;
+    Deque<SpeculativeToken> m_tokens;
+    // Tokens produced but not yet consumed by the main thread, including those it has already taken.
+    unsigned m_outstandingTokenCount { 0 };
+    bool m_isWaitingForConsumer { false };
+    bool m_hasPendingNotification { false };
+};
+
+} // namespace WebCore
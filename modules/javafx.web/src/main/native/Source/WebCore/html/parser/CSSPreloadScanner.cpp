@@ -49,15 +49,20 @@ void CSSPreloadScanner::reset()
 }
 
 void CSSPreloadScanner::scan(const HTMLToken::DataVector& data, PreloadRequestStream& requests)
+{
+    scan(data.data(), data.size(), requests);
+}
+
+void CSSPreloadScanner::scan(const UChar* characters, size_t length, PreloadRequestStream& requests)
 {
     ASSERT(!m_requests);
     SetForScope<PreloadRequestStream*> change(m_requests, &requests);
 
-    for (UChar c : data) {
+    for (size_t i = 0; i < length; ++i) {
         if (m_state == DoneParsingImportRules)
             break;
 
-        tokenize(c);
+        tokenize(characters[i]);
     }
 }
 
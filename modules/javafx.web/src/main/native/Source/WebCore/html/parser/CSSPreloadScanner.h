@@ -41,6 +41,7 @@ public:
     void reset();
 
     void scan(const HTMLToken::DataVector&, PreloadRequestStream&);
+    void scan(const UChar*, size_t length, PreloadRequestStream&);
 
 private:
     enum State {
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "HTMLToken.h"
+#include <wtf/text/StringView.h>
+
+namespace WebCore {
+
+// An HTMLToken without the inline buffers the tokenizer needs while it is building
+// a token. Compact tokens hold no AtomStrings, so they can be produced on one thread
+// and consumed on another.
+class CompactHTMLToken {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    struct Attribute {
+        Vector<UChar> name;
+        Vector<UChar> value;
+    };
+
+    explicit CompactHTMLToken(HTMLToken&);
+    CompactHTMLToken(CompactHTMLToken&&) = default;
+    CompactHTMLToken& operator=(CompactHTMLToken&&) = default;
+
+    HTMLToken::Type type() const { return m_type; }
+
+    // StartTag, EndTag, DOCTYPE.
+    const Vector<UChar>& name() const;
+
+    // StartTag, EndTag.
+    bool selfClosing() const;
+    const Vector<Attribute>& attributes() const;
+
+    // DOCTYPE.
+    std::unique_ptr<DoctypeData> releaseDoctypeData() { return WTFMove(m_doctypeData); }
+
+    // Character.
+    const Vector<UChar>& characters() const;
+    bool charactersIsAll8BitData() const;
+
+    // Comment.
+    const Vector<UChar>& comment() const;
+    bool commentIsAll8BitData() const;
+
+private:
+    HTMLToken::Type m_type;
+    bool m_selfClosing { false };
+    bool m_isAll8BitData { false };
+    Vector<UChar> m_data;
+    Vector<Attribute> m_attributes;
+    std::unique_ptr<DoctypeData> m_doctypeData;
+};
+
+const CompactHTMLToken::Attribute* findAttribute(const Vector<CompactHTMLToken::Attribute>&, StringView name);
+
+inline const Vector<UChar>& CompactHTMLToken::name() const
+{
+    ASSERT(m_type == HTMLToken::StartTag || m_type == HTMLToken::EndTag || m_type == HTMLToken::DOCTYPE);
+    return m_data;
+}
+
+inline bool CompactHTMLToken::selfClosing() const
+{
+    ASSERT(m_type == HTMLToken::StartTag || m_type == HTMLToken::EndTag);
+    return m_selfClosing;
+}
+
+inline const Vector<CompactHTMLToken::Attribute>& CompactHTMLToken::attributes() const
+{
+    ASSERT(m_type == HTMLToken::StartTag || m_type == HTMLToken::EndTag);
+    return m_attributes;
+}
+
+inline const Vector<UChar>& CompactHTMLToken::characters() const
+{
+    ASSERT(m_type == HTMLToken::Character);
+    return m_data;
+}
+
+inline bool CompactHTMLToken::charactersIsAll8BitData() const
+{
+    ASSERT(m_type == HTMLToken::Character);
+    return m_isAll8BitData;
+}
+
+inline const Vector<UChar>& CompactHTMLToken::comment() const
+{
+    ASSERT(m_type == HTMLToken::Comment);
+    return m_data;
+}
+
+inline bool CompactHTMLToken::commentIsAll8BitData() const
+{
+    ASSERT(m_type == HTMLToken::Comment);
+    return m_isAll8BitData;
+}
+
+} // namespace WebCore
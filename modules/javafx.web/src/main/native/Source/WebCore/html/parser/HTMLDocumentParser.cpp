@@ -42,6 +42,7 @@
 #include "LinkLoader.h"
 #include "NavigationScheduler.h"
 #include "ScriptElement.h"
+#include "Settings.h"
 #include "ThrowOnDynamicMarkupInsertionCountIncrementer.h"
 
 #include <wtf/SystemTracing.h>
@@ -52,6 +53,11 @@ using namespace HTMLNames;
 
 DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HTMLDocumentParser);
 
+// Speculative tokenization starts once at least this many characters are waiting to be
+// tokenized, and is not retried after the tree builder has disagreed with it this often.
+static constexpr unsigned minimumLengthForSpeculation = 16 * 1024;
+static constexpr unsigned maximumAbandonedSpeculationCount = 4;
+
 static bool isMainDocumentLoadingFromHTTP(const Document& document)
 {
     return !document.ownerElement() && document.url().protocolIsInHTTPFamily();
@@ -100,6 +106,7 @@ HTMLDocumentParser::~HTMLDocumentParser()
     ASSERT(!m_pumpSessionNestingLevel);
     ASSERT(!m_preloadScanner);
     ASSERT(!m_insertionPreloadScanner);
+    ASSERT(!m_backgroundTokenizer);
 }
 
 void HTMLDocumentParser::detach()
@@ -113,12 +120,14 @@ void HTMLDocumentParser::detach()
     m_preloadScanner = nullptr;
     m_insertionPreloadScanner = nullptr;
     m_parserScheduler = nullptr; // Deleting the scheduler will clear any timers.
+    stopSpeculating();
 }
 
 void HTMLDocumentParser::stopParsing()
 {
     DocumentParser::stopParsing();
     m_parserScheduler = nullptr; // Deleting the scheduler will clear any timers.
+    stopSpeculating();
 }
 
 // This kicks off "Once the user agent stops parsing" as described by:
@@ -159,7 +168,7 @@ inline bool HTMLDocumentParser::inPumpSession() const
 
 inline bool HTMLDocumentParser::shouldDelayEnd() const
 {
-    return inPumpSession() || isWaitingForScripts() || isScheduledForResume() || isExecutingScript();
+    return inPumpSession() || isWaitingForScripts() || isScheduledForResume() || isExecutingScript() || m_backgroundTokenizer;
 }
 
 void HTMLDocumentParser::didBeginYieldingParser()
@@ -179,7 +188,7 @@ bool HTMLDocumentParser::isParsingFragment() const
 
 bool HTMLDocumentParser::processingData() const
 {
-    return isScheduledForResume() || inPumpSession();
+    return isScheduledForResume() || inPumpSession() || m_backgroundTokenizer;
 }
 
 void HTMLDocumentParser::pumpTokenizerIfPossible(SynchronousMode mode)
@@ -277,6 +286,17 @@ bool HTMLDocumentParser::pumpTokenizerLoop(SynchronousMode mode, bool parsingFra
         if (UNLIKELY(mode == AllowYield && m_parserScheduler->shouldYieldBeforeToken(session)))
             return true;
 
+        if (UNLIKELY(m_speculationWaitsForDataState) && m_tokenizer.isInDataState())
+            startSpeculatingIfPossible();
+
+        if (m_backgroundTokenizer) {
+            // didReceiveSpeculativeTokens() pumps again once more tokens are ready.
+            if (m_speculativeTokens.isEmpty())
+                return false;
+            constructTreeFromSpeculativeToken();
+            continue;
+        }
+
         if (!parsingFragment)
             m_sourceTracker.startToken(m_input.current(), m_tokenizer);
 
@@ -310,6 +330,7 @@ void HTMLDocumentParser::pumpTokenizer(SynchronousMode mode)
     PumpSession session(m_pumpSessionNestingLevel, contextForParsingSession());
 
     m_xssAuditor.init(document(), &m_xssAuditorDelegate);
+    startSpeculatingIfPossible();
 
     auto emitTracePoint = [this](TracePointCode code) {
         if (!m_shouldEmitTracePoints)
@@ -335,11 +356,17 @@ void HTMLDocumentParser::pumpTokenizer(SynchronousMode mode)
 
     if (isWaitingForScripts() && !isDetached()) {
         ASSERT(m_tokenizer.isInDataState());
-        if (!m_preloadScanner) {
-            m_preloadScanner = makeUnique<HTMLPreloadScanner>(m_options, document()->url(), document()->deviceScaleFactor());
-            m_preloadScanner->appendToEnd(m_input.current());
+        // Tokenize what has arrived so far while the script loads, instead of only preload scanning it.
+        startSpeculatingIfPossible();
+        if (m_backgroundTokenizer)
+            scanSpeculativeTokensForPreloads();
+        else {
+            if (!m_preloadScanner) {
+                m_preloadScanner = makeUnique<HTMLPreloadScanner>(m_options, document()->url(), document()->deviceScaleFactor());
+                m_preloadScanner->appendToEnd(m_input.current());
+            }
+            m_preloadScanner->scan(*m_preloader, *document());
         }
-        m_preloadScanner->scan(*m_preloader, *document());
     }
     // The viewport definition is known here, so we can load link preloads with media attributes.
     if (document()->loader())
@@ -369,6 +396,137 @@ void HTMLDocumentParser::constructTreeFromHTMLToken(HTMLTokenizer::TokenPtr& raw
     m_treeBuilder->constructTree(WTFMove(token));
 }
 
+void HTMLDocumentParser::startSpeculatingIfPossible()
+{
+    m_speculationWaitsForDataState = false;
+
+    if (m_backgroundTokenizer || isStopped() || isDetached() || isParsingFragment() || wasCreatedByScript())
+        return;
+
+    if (!document()->settings().speculativeHTMLTokenizationEnabled() || m_abandonedSpeculationCount >= maximumAbandonedSpeculationCount)
+        return;
+
+    // The end of file is forwarded by finish(), and document.write() output is never speculated on.
+    if (m_input.hasInsertionPoint() || m_input.haveSeenEndOfFile() || m_input.current().length() < minimumLengthForSpeculation)
+        return;
+
+    // The XSS auditor needs the source of every token, which only the main thread tokenizer tracks.
+    m_xssAuditor.init(document(), &m_xssAuditorDelegate);
+    if (m_xssAuditor.isFiltering())
+        return;
+
+    // Foreign content needs the real tree builder to tell where integration points are.
+    if (m_tokenizer.shouldAllowCDATA())
+        return;
+
+    // A checkpoint only holds the state carried between tokens. If the input ended inside a
+    // tag, an attribute, a character reference or a comment, the partial token and the source
+    // it consumed are not in it, so wait until m_tokenizer is back in the data state.
+    if (!m_tokenizer.isInDataState() || m_tokenizer.hasPendingToken()) {
+        m_speculationWaitsForDataState = true;
+        return;
+    }
+
+    m_preloadScanner = nullptr;
+    m_backgroundTokenizer = BackgroundHTMLTokenizer::create(*this, m_options, m_tokenizer.checkpoint(), m_input.current().toString());
+}
+
+void HTMLDocumentParser::stopSpeculating()
+{
+    if (!m_backgroundTokenizer)
+        return;
+
+    m_backgroundTokenizer->stop();
+    m_backgroundTokenizer = nullptr;
+    m_speculativeTokens.clear();
+    m_speculativePreloadScanner = nullptr;
+    m_preloadScannedSpeculativeTokenCount = 0;
+}
+
+void HTMLDocumentParser::didReceiveSpeculativeTokens()
+{
+    ASSERT(m_backgroundTokenizer);
+
+    // pumpTokenizer can cause this parser to be detached from the Document,
+    // but we need to ensure it isn't deleted yet.
+    Ref<HTMLDocumentParser> protectedThis(*this);
+
+    auto tokens = m_backgroundTokenizer->takeTokens();
+    while (!tokens.isEmpty())
+        m_speculativeTokens.append(tokens.takeFirst());
+
+    if (isWaitingForScripts()) {
+        scanSpeculativeTokensForPreloads();
+        return;
+    }
+
+    // A nested pump, or one already scheduled, picks the new tokens up.
+    if (inPumpSession())
+        return;
+
+    pumpTokenizerIfPossible(AllowYield);
+    endIfDelayed();
+}
+
+void HTMLDocumentParser::constructTreeFromSpeculativeToken()
+{
+    ASSERT(m_backgroundTokenizer);
+
+    auto speculativeToken = m_speculativeTokens.takeFirst();
+    if (m_preloadScannedSpeculativeTokenCount)
+        --m_preloadScannedSpeculativeTokenCount;
+    m_backgroundTokenizer->didConsumeToken();
+
+    // Leave the input stream and the tokenizer exactly where m_tokenizer would have left them after
+    // producing this token, so text positions are right and we can fall back to m_tokenizer at any time.
+    auto& source = m_input.current();
+    ASSERT(source.length() >= speculativeToken.sourceLength);
+    for (unsigned i = 0; i < speculativeToken.sourceLength; ++i)
+        source.advance();
+    m_tokenizer.restoreCheckpoint(speculativeToken.checkpoint);
+
+    bool isEndOfFile = speculativeToken.token.type() == HTMLToken::EndOfFile;
+    m_treeBuilder->constructTree(AtomHTMLToken(speculativeToken.token));
+
+    // Script run by the tree builder may have called document.write(), which stops speculation.
+    if (!m_backgroundTokenizer)
+        return;
+
+    if (isEndOfFile) {
+        stopSpeculating();
+        return;
+    }
+
+    if (!m_tokenizer.isAtCheckpoint(speculativeToken.predictedCheckpoint)) {
+        // The tree builder left the tokenizer in a state the simulator did not predict, so
+        // the remaining tokens may be wrong. m_tokenizer continues from the right state.
+        ++m_abandonedSpeculationCount;
+        stopSpeculating();
+    }
+}
+
+void HTMLDocumentParser::scanSpeculativeTokensForPreloads()
+{
+    ASSERT(m_backgroundTokenizer);
+
+    if (!m_speculativePreloadScanner)
+        m_speculativePreloadScanner = makeUnique<TokenPreloadScanner>(document()->url(), document()->deviceScaleFactor());
+
+    const URL& startingBaseElementURL = document()->baseElementURL();
+    if (!startingBaseElementURL.isEmpty())
+        m_speculativePreloadScanner->setPredictedBaseElementURL(startingBaseElementURL);
+
+    PreloadRequestStream requests;
+    size_t index = 0;
+    for (auto& speculativeToken : m_speculativeTokens) {
+        if (index++ >= m_preloadScannedSpeculativeTokenCount)
+            m_speculativePreloadScanner->scan(speculativeToken.token, requests, *document());
+    }
+    m_preloadScannedSpeculativeTokenCount = m_speculativeTokens.size();
+
+    m_preloader->preload(WTFMove(requests));
+}
+
 bool HTMLDocumentParser::hasInsertionPoint()
 {
     // FIXME: The wasCreatedByScript() branch here might not be fully correct.
@@ -387,6 +545,12 @@ void HTMLDocumentParser::insert(SegmentedString&& source)
     // but we need to ensure it isn't deleted yet.
     Ref<HTMLDocumentParser> protectedThis(*this);
 
+    // The speculative tokens were produced without the inserted source.
+    if (m_backgroundTokenizer) {
+        ++m_abandonedSpeculationCount;
+        stopSpeculating();
+    }
+
     source.setExcludeLineNumbers();
     m_input.insertAtCurrentInsertionPoint(WTFMove(source));
     pumpTokenizerIfPossible(ForceSynchronous);
@@ -428,6 +592,11 @@ void HTMLDocumentParser::append(RefPtr<StringImpl>&& inputSource)
 
     m_input.appendToEnd(source);
 
+    if (m_backgroundTokenizer)
+        m_backgroundTokenizer->append(source);
+    else if (isWaitingForScripts())
+        startSpeculatingIfPossible();
+
     if (inPumpSession()) {
         // We've gotten data off the network in a nested write.
         // We don't want to consume any more of the input stream now.  Do
@@ -492,8 +661,11 @@ void HTMLDocumentParser::finish()
     // We're not going to get any more data off the network, so we tell the
     // input stream we've reached the end of file. finish() can be called more
     // than once, if the first time does not call end().
-    if (!m_input.haveSeenEndOfFile())
+    if (!m_input.haveSeenEndOfFile()) {
         m_input.markEndOfFile();
+        if (m_backgroundTokenizer)
+            m_backgroundTokenizer->finish();
+    }
 
     attemptToEnd();
 }
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "BackgroundHTMLTokenizer.h"
 #include "HTMLInputStream.h"
 #include "HTMLScriptRunnerHost.h"
 #include "HTMLSourceTracker.h"
@@ -46,6 +47,7 @@ class HTMLScriptRunner;
 class HTMLTreeBuilder;
 class HTMLResourcePreloader;
 class PumpSession;
+class TokenPreloadScanner;
 
 DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HTMLDocumentParser);
 class HTMLDocumentParser : public ScriptableDocumentParser, private HTMLScriptRunnerHost, private PendingScriptClient {
@@ -63,6 +65,9 @@ public:
     HTMLTokenizer& tokenizer();
     TextPosition textPosition() const final;
 
+    // For BackgroundHTMLTokenizer.
+    void didReceiveSpeculativeTokens();
+
 protected:
     explicit HTMLDocumentParser(HTMLDocument&);
 
@@ -109,6 +114,11 @@ private:
     void pumpTokenizerIfPossible(SynchronousMode);
     void constructTreeFromHTMLToken(HTMLTokenizer::TokenPtr&);
 
+    void startSpeculatingIfPossible();
+    void stopSpeculating();
+    void constructTreeFromSpeculativeToken();
+    void scanSpeculativeTokensForPreloads();
+
     void runScriptsForPausedTreeBuilder();
     void resumeParsingAfterScriptExecution();
 
@@ -141,6 +151,16 @@ private:
 
     std::unique_ptr<HTMLResourcePreloader> m_preloader;
 
+    // While m_backgroundTokenizer is set, tokens come from it instead of m_tokenizer. The input
+    // stream is still advanced past each token, so falling back to m_tokenizer is always possible.
+    RefPtr<BackgroundHTMLTokenizer> m_backgroundTokenizer;
+    Deque<BackgroundHTMLTokenizer::SpeculativeToken> m_speculativeTokens;
+    std::unique_ptr<TokenPreloadScanner> m_speculativePreloadScanner;
+    size_t m_preloadScannedSpeculativeTokenCount { 0 };
+    unsigned m_abandonedSpeculationCount { 0 };
+    // Set when speculation could start but m_tokenizer is inside a token; retried between tokens.
+    bool m_speculationWaitsForDataState { false };
+
     bool m_endWasDelayed { false };
     unsigned m_pumpSessionNestingLevel { 0 };
     bool m_shouldEmitTracePoints { false };
@@ -51,7 +51,7 @@ namespace WebCore {
 
 using namespace HTMLNames;
 
-TokenPreloadScanner::TagId TokenPreloadScanner::tagIdFor(const HTMLToken::DataVector& data)
+template<size_t inlineCapacity> TokenPreloadScanner::TagId TokenPreloadScanner::tagIdFor(const Vector<UChar, inlineCapacity>& data)
 {
     AtomString tagName(data);
     if (tagName == imgTag)
@@ -116,7 +116,7 @@ public:
     {
     }
 
-    void processAttributes(const HTMLToken::AttributeList& attributes, Vector<bool>& pictureState)
+    template<typename AttributeList> void processAttributes(const AttributeList& attributes, Vector<bool>& pictureState)
     {
         ASSERT(isMainThread());
         if (m_tagId >= TagId::Unknown)
@@ -414,12 +414,22 @@ TokenPreloadScanner::TokenPreloadScanner(const URL& documentURL, float deviceSca
 }
 
 void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<PreloadRequest>>& requests, Document& document)
+{
+    scanToken(token, requests, document);
+}
+
+void TokenPreloadScanner::scan(const CompactHTMLToken& token, Vector<std::unique_ptr<PreloadRequest>>& requests, Document& document)
+{
+    scanToken(token, requests, document);
+}
+
+template<typename Token> void TokenPreloadScanner::scanToken(const Token& token, Vector<std::unique_ptr<PreloadRequest>>& requests, Document& document)
 {
     switch (token.type()) {
     case HTMLToken::Character:
         if (!m_inStyle)
             return;
-        m_cssScanner.scan(token.characters(), requests);
+        m_cssScanner.scan(token.characters().data(), token.characters().size(), requests);
         return;
 
     case HTMLToken::EndTag: {
@@ -475,7 +485,7 @@ void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<Pr
     }
 }
 
-void TokenPreloadScanner::updatePredictedBaseURL(const HTMLToken& token, bool shouldRestrictBaseURLSchemes)
+template<typename Token> void TokenPreloadScanner::updatePredictedBaseURL(const Token& token, bool shouldRestrictBaseURLSchemes)
 {
     ASSERT(m_predictedBaseElementURL.isEmpty());
     auto* hrefAttribute = findAttribute(token.attributes(), hrefAttr->localName().string());
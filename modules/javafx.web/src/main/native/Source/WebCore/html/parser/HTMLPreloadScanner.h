@@ -27,6 +27,7 @@
 #pragma once
 
 #include "CSSPreloadScanner.h"
+#include "CompactHTMLToken.h"
 #include "HTMLTokenizer.h"
 #include "SegmentedString.h"
 
@@ -38,6 +39,7 @@ public:
     explicit TokenPreloadScanner(const URL& documentURL, float deviceScaleFactor = 1.0);
 
     void scan(const HTMLToken&, PreloadRequestStream&, Document&);
+    void scan(const CompactHTMLToken&, PreloadRequestStream&, Document&);
 
     void setPredictedBaseElementURL(const URL& url) { m_predictedBaseElementURL = url; }
 
@@ -63,11 +65,12 @@ private:
 
     class StartTagScanner;
 
-    static TagId tagIdFor(const HTMLToken::DataVector&);
+    template<size_t inlineCapacity> static TagId tagIdFor(const Vector<UChar, inlineCapacity>&);
 
     static String initiatorFor(TagId);
 
-    void updatePredictedBaseURL(const HTMLToken&, bool shouldRestrictBaseURLSchemes);
+    template<typename Token> void scanToken(const Token&, PreloadRequestStream&, Document&);
+    template<typename Token> void updatePredictedBaseURL(const Token&, bool shouldRestrictBaseURLSchemes);
 
     CSSPreloadScanner m_cssScanner;
     const URL m_documentURL;
@@ -1422,6 +1422,46 @@ void HTMLTokenizer::updateStateFor(const AtomString& tagName)
         m_state = RAWTEXTState;
 }
 
+auto HTMLTokenizer::checkpoint() const -> Checkpoint
+{
+    ASSERT(!haveBufferedCharacterToken());
+    Checkpoint checkpoint;
+    checkpoint.state = m_state;
+    checkpoint.forceNullCharacterReplacement = m_forceNullCharacterReplacement;
+    checkpoint.shouldAllowCDATA = m_shouldAllowCDATA;
+    checkpoint.skipNextNewLine = m_preprocessor.skipNextNewLine();
+    checkpoint.additionalAllowedCharacter = m_additionalAllowedCharacter;
+    checkpoint.appropriateEndTagName = m_appropriateEndTagName;
+    checkpoint.temporaryBuffer = m_temporaryBuffer;
+    checkpoint.bufferedEndTagName = m_bufferedEndTagName;
+    return checkpoint;
+}
+
+void HTMLTokenizer::restoreCheckpoint(const Checkpoint& checkpoint)
+{
+    m_state = checkpoint.state;
+    m_forceNullCharacterReplacement = checkpoint.forceNullCharacterReplacement;
+    m_shouldAllowCDATA = checkpoint.shouldAllowCDATA;
+    m_preprocessor.setSkipNextNewLine(checkpoint.skipNextNewLine);
+    m_additionalAllowedCharacter = checkpoint.additionalAllowedCharacter;
+    m_appropriateEndTagName = checkpoint.appropriateEndTagName;
+    m_temporaryBuffer = checkpoint.temporaryBuffer;
+    m_bufferedEndTagName = checkpoint.bufferedEndTagName;
+    m_token.clear();
+}
+
+bool HTMLTokenizer::isAtCheckpoint(const Checkpoint& checkpoint) const
+{
+    return m_state == checkpoint.state
+        && m_forceNullCharacterReplacement == checkpoint.forceNullCharacterReplacement
+        && m_shouldAllowCDATA == checkpoint.shouldAllowCDATA
+        && m_preprocessor.skipNextNewLine() == checkpoint.skipNextNewLine
+        && m_additionalAllowedCharacter == checkpoint.additionalAllowedCharacter
+        && m_appropriateEndTagName == checkpoint.appropriateEndTagName
+        && m_temporaryBuffer == checkpoint.temporaryBuffer
+        && m_bufferedEndTagName == checkpoint.bufferedEndTagName;
+}
+
 inline void HTMLTokenizer::appendToTemporaryBuffer(UChar character)
 {
     ASSERT(isASCII(character));
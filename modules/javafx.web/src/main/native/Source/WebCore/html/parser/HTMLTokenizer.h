@@ -70,6 +70,8 @@ public:
     void setShouldAllowCDATA(bool);
 
     bool isInDataState() const;
+    // True while a token is partially built, for instance when the input ended inside a tag.
+    bool hasPendingToken() const;
 
     void setDataState();
     void setPLAINTEXTState();
@@ -79,6 +81,13 @@ public:
 
     bool neverSkipNullCharacters() const;
 
+    // The state the tokenizer carries from one token to the next. Restoring a checkpoint
+    // taken from another tokenizer lets this one continue exactly where that one stopped.
+    struct Checkpoint;
+    Checkpoint checkpoint() const;
+    void restoreCheckpoint(const Checkpoint&);
+    bool isAtCheckpoint(const Checkpoint&) const;
+
 private:
     enum State {
         DataState,
@@ -211,6 +220,17 @@ private:
     const HTMLParserOptions m_options;
 };
 
+struct HTMLTokenizer::Checkpoint {
+    State state { DataState };
+    bool forceNullCharacterReplacement { false };
+    bool shouldAllowCDATA { false };
+    bool skipNextNewLine { false };
+    UChar additionalAllowedCharacter { 0 };
+    Vector<UChar> appropriateEndTagName;
+    Vector<LChar> temporaryBuffer;
+    Vector<LChar> bufferedEndTagName;
+};
+
 class HTMLTokenizer::TokenPtr {
 public:
     TokenPtr();
@@ -317,6 +337,11 @@ inline bool HTMLTokenizer::isInDataState() const
     return m_state == DataState;
 }
 
+inline bool HTMLTokenizer::hasPendingToken() const
+{
+    return m_token.type() != HTMLToken::Uninitialized;
+}
+
 inline void HTMLTokenizer::setDataState()
 {
     m_state = DataState;
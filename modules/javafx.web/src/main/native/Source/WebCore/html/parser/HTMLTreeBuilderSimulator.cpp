@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "HTMLTreeBuilderSimulator.h"
+
+#include "CompactHTMLToken.h"
+#include "HTMLTokenizer.h"
+#include <wtf/text/StringView.h>
+
+namespace WebCore {
+
+static inline StringView stringView(const Vector<UChar>& characters)
+{
+    return { characters.data(), static_cast<unsigned>(characters.size()) };
+}
+
+template<unsigned length> static inline bool tagNameIs(const CompactHTMLToken& token, const char (&tagName)[length])
+{
+    // The tokenizer has already folded ASCII tag names to lowercase.
+    return equalLettersIgnoringASCIICase(stringView(token.name()), tagName);
+}
+
+// https://html.spec.whatwg.org/#parsing-main-inforeign
+static bool tokenExitsForeignContent(const CompactHTMLToken& token)
+{
+    if (tagNameIs(token, "font"))
+        return findAttribute(token.attributes(), "color") || findAttribute(token.attributes(), "face") || findAttribute(token.attributes(), "size");
+
+    return tagNameIs(token, "b")
+        || tagNameIs(token, "big")
+        || tagNameIs(token, "blockquote")
+        || tagNameIs(token, "body")
+        || tagNameIs(token, "br")
+        || tagNameIs(token, "center")
+        || tagNameIs(token, "code")
+        || tagNameIs(token, "dd")
+        || tagNameIs(token, "div")
+        || tagNameIs(token, "dl")
+        || tagNameIs(token, "dt")
+        || tagNameIs(token, "em")
+        || tagNameIs(token, "embed")
+        || tagNameIs(token, "h1")
+        || tagNameIs(token, "h2")
+        || tagNameIs(token, "h3")
+        || tagNameIs(token, "h4")
+        || tagNameIs(token, "h5")
+        || tagNameIs(token, "h6")
+        || tagNameIs(token, "head")
+        || tagNameIs(token, "hr")
+        || tagNameIs(token, "i")
+        || tagNameIs(token, "img")
+        || tagNameIs(token, "li")
+        || tagNameIs(token, "listing")
+        || tagNameIs(token, "menu")
+        || tagNameIs(token, "meta")
+        || tagNameIs(token, "nobr")
+        || tagNameIs(token, "ol")
+        || tagNameIs(token, "p")
+        || tagNameIs(token, "pre")
+        || tagNameIs(token, "ruby")
+        || tagNameIs(token, "s")
+        || tagNameIs(token, "small")
+        || tagNameIs(token, "span")
+        || tagNameIs(token, "strong")
+        || tagNameIs(token, "strike")
+        || tagNameIs(token, "sub")
+        || tagNameIs(token, "sup")
+        || tagNameIs(token, "table")
+        || tagNameIs(token, "tt")
+        || tagNameIs(token, "u")
+        || tagNameIs(token, "ul")
+        || tagNameIs(token, "var");
+}
+
+// https://html.spec.whatwg.org/#html-integration-point
+static bool isSVGIntegrationPoint(const CompactHTMLToken& token)
+{
+    return tagNameIs(token, "foreignobject") || tagNameIs(token, "desc") || tagNameIs(token, "title");
+}
+
+// https://html.spec.whatwg.org/#mathml-text-integration-point
+static bool isMathMLIntegrationPoint(const CompactHTMLToken& token)
+{
+    if (tagNameIs(token, "annotation-xml")) {
+        if (token.type() == HTMLToken::EndTag)
+            return true;
+        auto* encoding = findAttribute(token.attributes(), "encoding");
+        return encoding
+            && (equalLettersIgnoringASCIICase(stringView(encoding->value), "text/html")
+                || equalLettersIgnoringASCIICase(stringView(encoding->value), "application/xhtml+xml"));
+    }
+    return tagNameIs(token, "mi") || tagNameIs(token, "mo") || tagNameIs(token, "mn") || tagNameIs(token, "ms") || tagNameIs(token, "mtext");
+}
+
+HTMLTreeBuilderSimulator::HTMLTreeBuilderSimulator(const HTMLParserOptions& options, bool inTextMode)
+    : m_options(options)
+    , m_inTextMode(inTextMode)
+{
+}
+
+void HTMLTreeBuilderSimulator::simulate(const CompactHTMLToken& token, HTMLTokenizer& tokenizer)
+{
+    switch (token.type()) {
+    case HTMLToken::StartTag:
+        if (inForeignContent() && tokenExitsForeignContent(token)) {
+            while (inForeignContent())
+                m_namespaceStack.removeLast();
+        }
+        if (inForeignContent()) {
+            if (!token.selfClosing()) {
+                auto currentNamespace = m_namespaceStack.last();
+                if ((currentNamespace == Namespace::SVG && isSVGIntegrationPoint(token))
+                    || (currentNamespace == Namespace::MathML && isMathMLIntegrationPoint(token)))
+                    m_namespaceStack.append(Namespace::HTML);
+                else if (tagNameIs(token, "svg"))
+                    m_namespaceStack.append(Namespace::SVG);
+                else if (tagNameIs(token, "math"))
+                    m_namespaceStack.append(Namespace::MathML);
+            }
+            break;
+        }
+        if (tagNameIs(token, "svg")) {
+            if (!token.selfClosing())
+                m_namespaceStack.append(Namespace::SVG);
+        } else if (tagNameIs(token, "math")) {
+            if (!token.selfClosing())
+                m_namespaceStack.append(Namespace::MathML);
+        } else
+            updateTokenizerStateForStartTag(token, tokenizer);
+        break;
+    case HTMLToken::EndTag:
+        // Any end tag seen in the text insertion mode is the one that ends it.
+        m_inTextMode = false;
+        if (m_namespaceStack.isEmpty())
+            break;
+        switch (m_namespaceStack.last()) {
+        case Namespace::SVG:
+            if (tagNameIs(token, "svg"))
+                m_namespaceStack.removeLast();
+            break;
+        case Namespace::MathML:
+            if (tagNameIs(token, "math"))
+                m_namespaceStack.removeLast();
+            break;
+        case Namespace::HTML: {
+            auto parentNamespace = m_namespaceStack[m_namespaceStack.size() - 2];
+            if ((parentNamespace == Namespace::SVG && isSVGIntegrationPoint(token))
+                || (parentNamespace == Namespace::MathML && isMathMLIntegrationPoint(token)))
+                m_namespaceStack.removeLast();
+            break;
+        }
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Mirrors the end of HTMLTreeBuilder::constructTree().
+    tokenizer.setForceNullCharacterReplacement(m_inTextMode || inForeignContent());
+    tokenizer.setShouldAllowCDATA(inForeignContent());
+}
+
+// Keep in sync with HTMLTokenizer::updateStateFor(), which needs AtomStrings.
+void HTMLTreeBuilderSimulator::updateTokenizerStateForStartTag(const CompactHTMLToken& token, HTMLTokenizer& tokenizer)
+{
+    if (tagNameIs(token, "textarea") || tagNameIs(token, "title"))
+        tokenizer.setRCDATAState();
+    else if (tagNameIs(token, "plaintext")) {
+        tokenizer.setPLAINTEXTState();
+        return;
+    } else if (tagNameIs(token, "script"))
+        tokenizer.setScriptDataState();
+    else if (tagNameIs(token, "style")
+        || tagNameIs(token, "iframe")
+        || tagNameIs(token, "xmp")
+        || tagNameIs(token, "noembed")
+        || tagNameIs(token, "noframes")
+        || (tagNameIs(token, "noscript") && m_options.scriptingFlag))
+        tokenizer.setRAWTEXTState();
+    else
+        return;
+    m_inTextMode = true;
+}
+
+} // namespace WebCore
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "HTMLParserOptions.h"
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+class CompactHTMLToken;
+class HTMLTokenizer;
+
+// Approximates the tokenizer state changes HTMLTreeBuilder makes after each token,
+// so that a tokenizer that has no tree builder can keep going on its own. It only
+// compares tag names against literals and never creates AtomStrings, so it can run
+// on a background thread. Whoever consumes the tokens checks the prediction against
+// the real tree builder.
+class HTMLTreeBuilderSimulator {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    // |inTextMode| tells whether the tree builder is in the text insertion mode, which
+    // is the case while the tokenizer is inside a script, style, title, etc. element.
+    HTMLTreeBuilderSimulator(const HTMLParserOptions&, bool inTextMode);
+
+    void simulate(const CompactHTMLToken&, HTMLTokenizer&);
+
+private:
+    enum class Namespace : uint8_t { HTML, SVG, MathML };
+
+    bool inForeignContent() const { return !m_namespaceStack.isEmpty() && m_namespaceStack.last() != Namespace::HTML; }
+    void updateTokenizerStateForStartTag(const CompactHTMLToken&, HTMLTokenizer&);
+
+    HTMLParserOptions m_options;
+    // Empty while nothing but HTML is open.
+    Vector<Namespace, 1> m_namespaceStack;
+    bool m_inTextMode;
+};
+
+} // namespace WebCore
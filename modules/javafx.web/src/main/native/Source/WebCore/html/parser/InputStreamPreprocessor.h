@@ -43,6 +43,11 @@ public:
 
     ALWAYS_INLINE UChar nextInputCharacter() const { return m_nextInputCharacter; }
 
+    // Whether a '\n' that follows a '\r' still has to be collapsed. This is the only
+    // state the preprocessor carries from one token to the next.
+    bool skipNextNewLine() const { return m_skipNextNewLine; }
+    void setSkipNextNewLine(bool skipNextNewLine) { m_skipNextNewLine = skipNextNewLine; }
+
     // Returns whether we succeeded in peeking at the next character.
     // The only way we can fail to peek is if there are no more
     // characters in |source| (after collapsing \r\n, etc).
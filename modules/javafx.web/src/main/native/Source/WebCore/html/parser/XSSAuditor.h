@@ -61,6 +61,9 @@ public:
 
     std::unique_ptr<XSSInfo> filterToken(const FilterTokenRequest&);
 
+    // Whether filterToken() can block anything in this document. Only valid after init().
+    bool isFiltering() const { return m_isEnabled && m_xssProtection != XSSProtectionDisposition::Disabled; }
+
 private:
     static const size_t kMaximumFragmentLengthTarget = 100;
 
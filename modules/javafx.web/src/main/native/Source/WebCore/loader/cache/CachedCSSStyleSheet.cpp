@@ -25,19 +25,67 @@
 #include "CachedCSSStyleSheet.h"
 
 #include "CSSStyleSheet.h"
+#include "CSSTokenizer.h"
 #include "CachedResourceClientWalker.h"
+#include "CachedResourceHandle.h"
 #include "CachedResourceRequest.h"
 #include "CachedStyleSheetClient.h"
+#include "Document.h"
+#include "Frame.h"
 #include "HTTPHeaderNames.h"
 #include "HTTPParsers.h"
 #include "MemoryCache.h"
 #include "ParsedContentType.h"
 #include "SharedBuffer.h"
 #include "StyleSheetContents.h"
+#include "SubresourceLoader.h"
 #include "TextResourceDecoder.h"
+#include <wtf/HashSet.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WorkQueue.h>
 
 namespace WebCore {
 
+// Sheets at least this long are tokenized on a background thread once they have loaded, which
+// keeps the main thread responsive while large framework stylesheets come in.
+static constexpr unsigned minimumLengthForBackgroundTokenization = 128 * 1024;
+
+static WorkQueue& backgroundTokenizationQueue()
+{
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("WebCore CSS Tokenizer", WorkQueue::Type::Serial, WorkQueue::QOS::UserInitiated));
+    return queue.get();
+}
+
+// Main thread only.
+static HashSet<CachedCSSStyleSheet*>& sheetsTokenizingInBackground()
+{
+    static NeverDestroyed<HashSet<CachedCSSStyleSheet*>> sheets;
+    return sheets;
+}
+
+struct CachedCSSStyleSheet::BackgroundTokenization : public ThreadSafeRefCounted<BackgroundTokenization> {
+    BackgroundTokenization(CachedCSSStyleSheet& sheet, String&& text, const NetworkLoadMetrics& metrics)
+        : sheet(&sheet)
+        , metrics(metrics)
+        , text(WTFMove(text))
+    {
+    }
+
+    // Main thread only. Cleared if the resource is destroyed before tokenization finishes,
+    // or if the sheet was needed before then and has been parsed synchronously.
+    CachedCSSStyleSheet* sheet;
+    NetworkLoadMetrics metrics;
+    // The document whose load event waits for the sheet, like it waits for the network load.
+    WeakPtr<Document> document;
+    // Set once the task is back on the main thread and |tokenizer| may be used there.
+    bool delivered { false };
+
+    // Used by the background thread until the task is posted back to the main thread.
+    String text;
+    std::unique_ptr<CSSTokenizer> tokenizer;
+};
+
 CachedCSSStyleSheet::CachedCSSStyleSheet(CachedResourceRequest&& request, PAL::SessionID sessionID, const CookieJar* cookieJar)
     : CachedResource(WTFMove(request), Type::CSSStyleSheet, sessionID, cookieJar)
     , m_decoder(TextResourceDecoder::create("text/css", request.charset()))
@@ -46,6 +94,8 @@ CachedCSSStyleSheet::CachedCSSStyleSheet(CachedResourceRequest&& request, PAL::S
 
 CachedCSSStyleSheet::~CachedCSSStyleSheet()
 {
+    if (m_backgroundTokenization)
+        detachBackgroundTokenization();
     if (m_parsedStyleSheetCache)
         m_parsedStyleSheetCache->removedFromMemoryCache();
 }
@@ -104,12 +154,113 @@ void CachedCSSStyleSheet::finishLoading(SharedBuffer* data, const NetworkLoadMet
     // Decode the data to find out the encoding and keep the sheet text around during checkNotify()
     if (data)
         m_decodedSheetText = m_decoder->decodeAndFlush(data->data(), data->size());
+    if (m_decodedSheetText.length() >= minimumLengthForBackgroundTokenization) {
+        // Clients are notified once the tokens are ready; until then the resource stays loading.
+        tokenizeInBackground(metrics);
+        return;
+    }
     setLoading(false);
     checkNotify(metrics);
     // Clear the decoded text as it is unlikely to be needed immediately again and is cheap to regenerate.
     m_decodedSheetText = String();
 }
 
+void CachedCSSStyleSheet::tokenizeInBackground(const NetworkLoadMetrics& metrics)
+{
+    ASSERT(isMainThread());
+
+    if (m_backgroundTokenization)
+        detachBackgroundTokenization();
+    m_backgroundTokenization = adoptRef(*new BackgroundTokenization(*this, m_decodedSheetText.isolatedCopy(), metrics));
+    sheetsTokenizingInBackground().add(this);
+
+    // The network load is done, so the loader is about to stop counting this resource
+    // against the document. Keep its load event pending until the sheet is delivered.
+    if (auto* loader = this->loader()) {
+        if (auto* frame = loader->frame()) {
+            if (auto* document = frame->document()) {
+                document->incrementLoadEventDelayCount();
+                m_backgroundTokenization->document = makeWeakPtr(*document);
+            }
+        }
+    }
+
+    backgroundTokenizationQueue().dispatch([task = m_backgroundTokenization]() mutable {
+        task->tokenizer = CSSTokenizer::tryCreate(task->text);
+        callOnMainThread([task = WTFMove(task)] {
+            if (task->sheet) {
+                task->delivered = true;
+                task->sheet->didFinishBackgroundTokenization();
+            }
+        });
+    });
+}
+
+// Stops waiting for the background task. Its result is dropped when it is posted back.
+void CachedCSSStyleSheet::detachBackgroundTokenization()
+{
+    ASSERT(isMainThread());
+    ASSERT(m_backgroundTokenization);
+
+    auto task = std::exchange(m_backgroundTokenization, nullptr);
+    task->sheet = nullptr;
+    sheetsTokenizingInBackground().remove(this);
+    if (auto document = std::exchange(task->document, nullptr))
+        document->decrementLoadEventDelayCount();
+}
+
+void CachedCSSStyleSheet::didFinishBackgroundTokenization()
+{
+    ASSERT(isMainThread());
+    ASSERT(m_backgroundTokenization);
+
+    // Notifying clients may run script that releases the last reference to this resource.
+    CachedResourceHandle<CachedCSSStyleSheet> protectedThis(this);
+
+    // The load may have been cancelled while the task was running, in which case clients
+    // have already been notified.
+    if (isLoading()) {
+        setLoading(false);
+        checkNotify(m_backgroundTokenization->metrics);
+    }
+    // Released after the clients have their sheet, so the load event sees it applied.
+    if (m_backgroundTokenization)
+        detachBackgroundTokenization();
+    m_decodedSheetText = String();
+}
+
+void CachedCSSStyleSheet::finishBackgroundTokenization(Document& document)
+{
+    ASSERT(isMainThread());
+
+    if (sheetsTokenizingInBackground().isEmpty())
+        return;
+
+    Vector<CachedResourceHandle<CachedCSSStyleSheet>> sheets;
+    for (auto* sheet : sheetsTokenizingInBackground()) {
+        if (sheet->m_backgroundTokenization->document.get() == &document)
+            sheets.append(sheet);
+    }
+
+    // Tokens are never read before the task is delivered, so these sheets are parsed from
+    // their text on the main thread, as sheets below the background threshold are.
+    for (auto& sheet : sheets) {
+        if (sheet->m_backgroundTokenization && !sheet->m_backgroundTokenization->delivered)
+            sheet->didFinishBackgroundTokenization();
+    }
+}
+
+std::unique_ptr<CSSTokenizer> CachedCSSStyleSheet::takeBackgroundTokenizer(const String& sheetText, String& tokenizedText) const
+{
+    ASSERT(isMainThread());
+
+    if (!m_backgroundTokenization || !m_backgroundTokenization->delivered || !m_backgroundTokenization->tokenizer || sheetText.impl() != m_decodedSheetText.impl())
+        return nullptr;
+
+    tokenizedText = m_backgroundTokenization->text;
+    return WTFMove(m_backgroundTokenization->tokenizer);
+}
+
 void CachedCSSStyleSheet::checkNotify(const NetworkLoadMetrics&)
 {
     if (isLoading())
@@ -26,6 +26,8 @@
 
 namespace WebCore {
 
+class CSSTokenizer;
+class Document;
 class FrameLoader;
 class StyleSheetContents;
 class TextResourceDecoder;
@@ -45,7 +47,21 @@ public:
 
     bool mimeTypeAllowedByNosniff() const;
 
+    // Returns the tokens produced on a background thread if |sheetText| is the text they
+    // were produced from. |tokenizedText| is set to the string the tokens point into.
+    std::unique_ptr<CSSTokenizer> takeBackgroundTokenizer(const String& sheetText, String& tokenizedText) const;
+
+    // Delivers the sheets still being tokenized for |document| now, parsing them on the main
+    // thread. Used when style or layout is needed without waiting for pending sheets.
+    static void finishBackgroundTokenization(Document&);
+
 private:
+    struct BackgroundTokenization;
+
+    void tokenizeInBackground(const NetworkLoadMetrics&);
+    void didFinishBackgroundTokenization();
+    void detachBackgroundTokenization();
+
     String responseMIMEType() const;
     bool canUseSheet(MIMETypeCheckHint, bool* hasValidMIMEType) const;
     bool mayTryReplaceEncodedData() const final { return true; }
@@ -66,6 +82,8 @@ private:
     String m_decodedSheetText;
 
     RefPtr<StyleSheetContents> m_parsedStyleSheetCache;
+
+    RefPtr<BackgroundTokenization> m_backgroundTokenization;
 };
 
 } // namespace WebCore
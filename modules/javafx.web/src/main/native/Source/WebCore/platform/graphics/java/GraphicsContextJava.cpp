@@ -826,30 +826,19 @@ void GraphicsContextJava::drawPlatformPattern(const PlatformImagePtr& image, con
     if (paintingDisabled() || !patternTransform.isInvertible())
         return;
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
     if (tileRect.isEmpty()) {
         return;
     }
 
     flushImageRQ(platformContext(), image);
 
-    TransformationMatrix tm = patternTransform.toTransformationMatrix();
-
-    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-                "createTransform",
-                "(DDDDDD)Lcom/sun/webkit/graphics/WCTransform;");
-    ASSERT(mid);
-    JLObject transform(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
-                tm.a(), tm.b(), tm.c(), tm.d(), tm.e(), tm.f()));
-    ASSERT(transform);
-    WTF::CheckAndClearException(env);
-
-    platformContext()->rq().freeSpace(13 * 4)
+    platformContext()->rq().freeSpace(18 * 4)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWPATTERN
         << image->getImage()
         << tileRect.x() << tileRect.y() << tileRect.width() << tileRect.height()
-        << RQRef::create(transform)
+        << (float)patternTransform.a() << (float)patternTransform.b()
+        << (float)patternTransform.c() << (float)patternTransform.d()
+        << (float)patternTransform.e() << (float)patternTransform.f()
         << phase.x() << phase.y()
         << destRect.x() << destRect.y() << destRect.width() << destRect.height();
 }
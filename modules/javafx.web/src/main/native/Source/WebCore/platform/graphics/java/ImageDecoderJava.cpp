@@ -74,6 +74,11 @@ ImageDecoderJava::ImageDecoderJava()
         midGetImageDecoder));
 
     WTF::CheckAndClearException(env);
+
+    // Resolve the classes used by createFrameImageAtIndex() here, because
+    // FindClass() cannot see them from the asynchronous decoding threads.
+    PG_GetGraphicsImageDecoderClass(env);
+    PG_GetImageFrameClass(env);
 }
 
 ImageDecoderJava::~ImageDecoderJava()
@@ -178,6 +183,8 @@ size_t ImageDecoderJava::frameCount() const
 
 PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
 {
+    // Also called on the asynchronous decoding queue of ImageSource, whose
+    // WorkQueue threads are attached to the JVM (see WorkQueueGeneric.cpp).
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -27,6 +27,8 @@
 
 #include "RQRef.h"
 
+#include <wtf/HashMap.h>
+
 namespace WebCore {
 
 RQRef::~RQRef()
@@ -49,17 +51,52 @@ RQRef::operator jint() {
     if (-1 == m_refID) {
         JNIEnv* env = WTF::GetJavaEnv();
 
-        static jmethodID midGetId = env->GetMethodID(PG_GetRefClass(env), "getID", "()I");
-        ASSERT(midGetId);
-        m_refID = env->CallIntMethod(m_ref, midGetId);
-
-        static jmethodID midRef = env->GetMethodID(PG_GetRefClass(env), "ref", "()V");
-        ASSERT(midRef);
-        env->CallVoidMethod(m_ref, midRef);
+        // Registers the object on the Java side and returns its ID
+        static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "fwkRef", "()I");
+        ASSERT(mid);
+        m_refID = env->CallIntMethod(m_ref, mid);
 
         WTF::CheckAndClearException(env);
     }
     return m_refID;
 }
 
+void RQRef::derefAll(JNIEnv* env, Vector<RefPtr<RQRef>>&& refs)
+{
+    // A reference dies with the list if the list holds all of its counts
+    HashMap<RQRef*, unsigned> counts;
+    for (auto& ref : refs) {
+        if (ref) {
+            counts.add(ref.get(), 0).iterator->value++;
+        }
+    }
+    Vector<RQRef*> dying;
+    for (auto& entry : counts) {
+        if (entry.key->m_refID != -1 && entry.key->refCount() == entry.value) {
+            dying.append(entry.key);
+        }
+    }
+
+    if (env && dying.size() > 1) {
+        JLObjectArray array(env->NewObjectArray(dying.size(), PG_GetRefClass(env), nullptr));
+        if (array) {
+            for (size_t i = 0; i < dying.size(); ++i) {
+                env->SetObjectArrayElement(array, i, dying[i]->m_ref);
+            }
+            static jmethodID mid = env->GetStaticMethodID(PG_GetRefClass(env),
+                "fwkDerefAll", "([Lcom/sun/webkit/graphics/Ref;)V");
+            ASSERT(mid);
+            env->CallStaticVoidMethod(PG_GetRefClass(env), mid, (jobjectArray)array);
+            WTF::CheckAndClearException(env);
+
+            // Already dereferenced, see ~RQRef
+            for (auto* ref : dying) {
+                ref->m_refID = -1;
+            }
+        }
+        WTF::CheckAndClearException(env);
+    }
+    refs.clear();
+}
+
 } // namespace WebCore
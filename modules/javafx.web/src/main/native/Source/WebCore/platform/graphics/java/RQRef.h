@@ -29,6 +29,7 @@
 #include "PlatformJavaClasses.h"
 #include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
@@ -45,6 +46,11 @@ public:
     }
     ~RQRef();
 
+    // Releases a list of references taken from render queue buffers. The
+    // Java objects that are not referenced from anywhere else are
+    // dereferenced with a single upcall rather than one per object.
+    static void derefAll(JNIEnv*, Vector<RefPtr<RQRef>>&&);
+
 private:
     RQRef(const JLObject &obj)
         : m_ref(obj)
@@ -135,11 +135,16 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
      * it should be thread safe.
      */
     Addr2ByteBuffer& a2bb = getAddr2ByteBuffer();
+    Vector<RefPtr<RQRef>> refs;
     for (int i = 0; i < env->GetArrayLength(bufs); ++i) {
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            RefPtr<ByteBuffer> buffer = a2bb.take(key);
+            if (buffer) {
+                refs.appendVector(buffer->takeRefList());
+            }
         }
     }
+    RQRef::derefAll(env, WTFMove(refs));
 }
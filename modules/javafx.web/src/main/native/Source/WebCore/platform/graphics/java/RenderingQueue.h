@@ -76,6 +76,8 @@ public:
 
     bool isEmpty() { return m_position == 0; }
 
+    Vector< RefPtr<RQRef> > takeRefList() { return WTFMove(m_refList); }
+
     ~ByteBuffer() {
         delete[] m_buffer;
     }
@@ -187,6 +187,7 @@ RenderStyle::RenderStyle(CreateDefaultStyleTag)
     m_nonInheritedFlags.hasExplicitlySetTextAlign = false;
     m_nonInheritedFlags.hasViewportUnits = false;
     m_nonInheritedFlags.hasExplicitlyInheritedProperties = false;
+    m_nonInheritedFlags.disallowsFastPathInheritance = false;
     m_nonInheritedFlags.isUnique = false;
     m_nonInheritedFlags.emptyState = false;
     m_nonInheritedFlags.firstChildState = false;
@@ -333,6 +334,22 @@ void RenderStyle::inheritFrom(const RenderStyle& inheritParent)
         m_svgStyle.access().inheritFrom(inheritParent.m_svgStyle.get());
 }
 
+void RenderStyle::fastPathInheritFrom(const RenderStyle& inheritParent)
+{
+    ASSERT(!disallowsFastPathInheritance());
+
+    // Only the colors are fast path inherited. Anything computed from them is resolved at use time.
+    if (m_inheritedData.ptr() == inheritParent.m_inheritedData.ptr())
+        return;
+    if (m_inheritedData->nonFastPathInheritedEqual(*inheritParent.m_inheritedData)) {
+        m_inheritedData = inheritParent.m_inheritedData;
+        return;
+    }
+    auto& inheritedData = m_inheritedData.access();
+    inheritedData.color = inheritParent.m_inheritedData->color;
+    inheritedData.visitedLinkColor = inheritParent.m_inheritedData->visitedLinkColor;
+}
+
 void RenderStyle::copyNonInheritedFrom(const RenderStyle& other)
 {
     m_boxData = other.m_boxData;
@@ -437,6 +454,14 @@ bool RenderStyle::inheritedEqual(const RenderStyle& other) const
         && m_rareInheritedData == other.m_rareInheritedData;
 }
 
+bool RenderStyle::nonFastPathInheritedEqual(const RenderStyle& other) const
+{
+    return m_inheritedFlags == other.m_inheritedFlags
+        && (m_inheritedData.ptr() == other.m_inheritedData.ptr() || m_inheritedData->nonFastPathInheritedEqual(*other.m_inheritedData))
+        && (m_svgStyle.ptr() == other.m_svgStyle.ptr() || m_svgStyle->inheritedEqual(other.m_svgStyle))
+        && m_rareInheritedData == other.m_rareInheritedData;
+}
+
 bool RenderStyle::descendantAffectingNonInheritedPropertiesEqual(const RenderStyle& other) const
 {
     if (m_rareNonInheritedData.ptr() == other.m_rareNonInheritedData.ptr())
@@ -60,14 +60,19 @@ Ref<StyleInheritedData> StyleInheritedData::copy() const
 }
 
 bool StyleInheritedData::operator==(const StyleInheritedData& o) const
+{
+    return nonFastPathInheritedEqual(o)
+        && color == o.color
+        && visitedLinkColor == o.visitedLinkColor;
+}
+
+bool StyleInheritedData::nonFastPathInheritedEqual(const StyleInheritedData& o) const
 {
     return lineHeight == o.lineHeight
 #if ENABLE(TEXT_AUTOSIZING)
         && specifiedLineHeight == o.specifiedLineHeight
 #endif
         && fontCascade == o.fontCascade
-        && color == o.color
-        && visitedLinkColor == o.visitedLinkColor
         && horizontalBorderSpacing == o.horizontalBorderSpacing
         && verticalBorderSpacing == o.verticalBorderSpacing;
 }
@@ -40,6 +40,9 @@ public:
     bool operator==(const StyleInheritedData&) const;
     bool operator!=(const StyleInheritedData& other) const { return !(*this == other); }
 
+    // Compares everything except the colors, which can be inherited without re-running the cascade.
+    bool nonFastPathInheritedEqual(const StyleInheritedData&) const;
+
     float horizontalBorderSpacing;
     float verticalBorderSpacing;
 
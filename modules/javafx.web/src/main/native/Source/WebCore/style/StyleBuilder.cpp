@@ -336,6 +336,10 @@ void Builder::applyProperty(CSSPropertyID id, CSSValue& value, SelectorChecker::
     if (isInherit && !CSSProperty::isInheritedProperty(id))
         m_state.style().setHasExplicitlyInheritedProperties();
 
+    // Elements that set 'color' can't have it copied from the parent by the style tree resolver fast path.
+    if (id == CSSPropertyColor)
+        m_state.style().setDisallowsFastPathInheritance();
+
 #if ENABLE(CSS_PAINTING_API)
     if (is<CSSPaintImageValue>(valueToApply)) {
         auto& name = downcast<CSSPaintImageValue>(valueToApply.get()).name();
@@ -953,8 +953,10 @@ inline void BuilderCustom::applyTextOrBoxShadowValue(BuilderState& builderState,
         Color color;
         if (shadowValue.color)
             color = builderState.colorFromPrimitiveValueWithResolvedCurrentColor(*shadowValue.color);
-        else
+        else {
             color = builderState.style().color();
+            builderState.style().setDisallowsFastPathInheritance();
+        }
 
         auto shadowData = makeUnique<ShadowData>(LayoutPoint(x, y), blur, spread, shadowStyle, property == CSSPropertyWebkitBoxShadow, color.isValid() ? color : Color::transparentBlack);
         if (property == CSSPropertyTextShadow)
@@ -1462,6 +1464,7 @@ inline void BuilderCustom::applyValueFill(BuilderState& builderState, CSSValue&
         paintType = url.isEmpty() ? SVGPaintType::None : SVGPaintType::URINone;
     else if (localValue->isValueID() && localValue->valueID() == CSSValueCurrentcolor) {
         color = builderState.style().color();
+        builderState.style().setDisallowsFastPathInheritance();
         paintType = url.isEmpty() ? SVGPaintType::CurrentColor : SVGPaintType::URICurrentColor;
     } else {
         color = builderState.colorFromPrimitiveValue(*localValue);
@@ -1506,6 +1509,7 @@ inline void BuilderCustom::applyValueStroke(BuilderState& builderState, CSSValue
         paintType = url.isEmpty() ? SVGPaintType::None : SVGPaintType::URINone;
     else if (localValue->isValueID() && localValue->valueID() == CSSValueCurrentcolor) {
         color = builderState.style().color();
+        builderState.style().setDisallowsFastPathInheritance();
         paintType = url.isEmpty() ? SVGPaintType::CurrentColor : SVGPaintType::URICurrentColor;
     } else {
         color = builderState.colorFromPrimitiveValue(*localValue);
@@ -57,11 +57,15 @@ Change determineChange(const RenderStyle& s1, const RenderStyle& s2)
     if (s1.hasTextCombine() != s2.hasTextCombine())
         return Change::Renderer;
 
-    if (!s1.inheritedEqual(s2))
+    if (!s1.descendantAffectingNonInheritedPropertiesEqual(s2))
         return Change::Inherited;
 
-    if (!s1.descendantAffectingNonInheritedPropertiesEqual(s2))
+    if (!s1.inheritedEqual(s2)) {
+        // Descendants that don't set or depend on 'color' only need the new colors copied over.
+        if (s1.nonFastPathInheritedEqual(s2))
+            return Change::FastPathInherited;
         return Change::Inherited;
+    }
 
     if (s1 != s2)
         return Change::NonInherited;
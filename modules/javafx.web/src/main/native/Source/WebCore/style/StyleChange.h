@@ -34,6 +34,7 @@ namespace Style {
 enum class Change {
     None,
     NonInherited,
+    FastPathInherited,
     Inherited,
     Renderer
 };
@@ -154,6 +154,40 @@ std::unique_ptr<RenderStyle> TreeResolver::styleForStyleable(const Styleable& st
     return WTFMove(elementStyle.renderStyle);
 }
 
+bool TreeResolver::canUseFastPathInheritance(const Element& element)
+{
+    // If the element is only resolved because the parent color changed we can copy the new color to the
+    // existing style instead of matching and applying rules again. This is common when a class change
+    // high up in a large tree recolors everything below it.
+    if (parent().change != Change::FastPathInherited || parent().descendantsToResolve == DescendantsToResolve::All)
+        return false;
+    if (!m_document.settings().fastPathStyleInheritanceEnabled())
+        return false;
+    if (element.styleValidity() != Validity::Valid || element.hasCustomStyleResolveCallbacks())
+        return false;
+
+    auto* existingStyle = element.renderOrDisplayContentsStyle();
+    if (!existingStyle || existingStyle->isNotFinal())
+        return false;
+    if (existingStyle->disallowsFastPathInheritance() || existingStyle->hasExplicitlyInheritedProperties())
+        return false;
+    // The existing style of an animated element has the animated values applied.
+    if (existingStyle->hasAnimationsOrTransitions() || element.hasKeyframeEffects(PseudoId::None))
+        return false;
+
+    return true;
+}
+
+std::unique_ptr<RenderStyle> TreeResolver::fastPathInheritedStyle(const Element& element)
+{
+    if (!canUseFastPathInheritance(element))
+        return nullptr;
+
+    auto style = RenderStyle::clonePtr(*element.renderOrDisplayContentsStyle());
+    style->fastPathInheritFrom(parent().style);
+    return style;
+}
+
 static void resetStyleForNonRenderedDescendants(Element& current)
 {
     for (auto& child : childrenOfType<Element>(current)) {
@@ -191,6 +225,7 @@ static DescendantsToResolve computeDescendantsToResolve(Change change, Validity
         return DescendantsToResolve::None;
     case Change::NonInherited:
         return DescendantsToResolve::ChildrenWithExplicitInherit;
+    case Change::FastPathInherited:
     case Change::Inherited:
         return DescendantsToResolve::Children;
     case Change::Renderer:
@@ -211,7 +246,9 @@ ElementUpdates TreeResolver::resolveElement(Element& element)
         return { };
 
     Styleable styleable { element, PseudoId::None };
-    auto newStyle = styleForStyleable(styleable, parent().style);
+    auto newStyle = fastPathInheritedStyle(element);
+    if (!newStyle)
+        newStyle = styleForStyleable(styleable, parent().style);
 
     if (!affectsRenderedSubtree(element, *newStyle))
         return { };
@@ -550,7 +587,9 @@ void TreeResolver::resolveComposedTree()
         if (shouldResolve) {
             if (!element.hasDisplayContents())
                 element.resetComputedStyle();
-            element.resetStyleRelations();
+            // The fast path doesn't match selectors, so it keeps the relations committed with the existing style.
+            if (!canUseFastPathInheritance(element))
+                element.resetStyleRelations();
 
             if (element.hasCustomStyleResolveCallbacks())
                 element.willRecalcStyle(parent.change);
@@ -583,7 +622,10 @@ void TreeResolver::resolveComposedTree()
             continue;
         }
 
-        resetDescendantStyleRelations(element, descendantsToResolve);
+        // Children on the fast path don't commit their relations again, so keep the ones recorded on this element.
+        // Children that fall back to matching only add to them.
+        if (change != Change::FastPathInherited || descendantsToResolve == DescendantsToResolve::All)
+            resetDescendantStyleRelations(element, descendantsToResolve);
 
         pushParent(element, *style, change, descendantsToResolve);
 
@@ -56,6 +56,8 @@ public:
 
 private:
     std::unique_ptr<RenderStyle> styleForStyleable(const Styleable&, const RenderStyle& inheritedStyle);
+    bool canUseFastPathInheritance(const Element&);
+    std::unique_ptr<RenderStyle> fastPathInheritedStyle(const Element&);
 
     void resolveComposedTree();
 
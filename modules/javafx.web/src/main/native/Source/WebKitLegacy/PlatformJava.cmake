@@ -29,6 +29,7 @@ list(APPEND WebKitLegacy_SOURCES
     java/DOM/JavaComment.cpp
     java/DOM/JavaCounter.cpp
     java/DOM/JavaDOMImplementation.cpp
+    java/DOM/JavaDOMSnapshot.cpp
     java/DOM/JavaDOMStringList.cpp
     java/DOM/JavaDOMWindow.cpp
     java/DOM/JavaDocument.cpp
@@ -131,6 +132,7 @@ list(APPEND WebKitLegacy_SOURCES
     java/WebCoreSupport/ChromeClientJava.cpp
     java/WebCoreSupport/BackForwardList.cpp
     java/WebCoreSupport/PageCacheJava.cpp
+    java/WebCoreSupport/SamplingProfilerJava.cpp
 
     java/storage/WebDatabaseProviderJava.cpp
 )
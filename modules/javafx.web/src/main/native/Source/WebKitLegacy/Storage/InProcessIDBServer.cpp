@@ -37,7 +37,9 @@
 #include <WebCore/IDBResultData.h>
 #include <WebCore/IDBTransactionInfo.h>
 #include <WebCore/IDBValue.h>
+#include <WebCore/SQLiteFileSystem.h>
 #include <WebCore/StorageQuotaManager.h>
+#include <wtf/FileSystem.h>
 #include <wtf/threads/BinarySemaphore.h>
 
 using namespace WebCore;
@@ -56,6 +58,15 @@ Ref<InProcessIDBServer> InProcessIDBServer::create(PAL::SessionID sessionID, con
     return adoptRef(*new InProcessIDBServer(sessionID, databaseDirectoryPath));
 }
 
+#if PLATFORM(JAVA)
+Ref<InProcessIDBServer> InProcessIDBServer::create(PAL::SessionID sessionID, const String& databaseDirectoryPath, uint64_t perOriginQuota)
+{
+    ASSERT(!sessionID.isEphemeral());
+
+    return adoptRef(*new InProcessIDBServer(sessionID, databaseDirectoryPath, perOriginQuota));
+}
+#endif
+
 InProcessIDBServer::~InProcessIDBServer()
 {
     BinarySemaphore semaphore;
@@ -72,8 +83,21 @@ InProcessIDBServer::~InProcessIDBServer()
 
 StorageQuotaManager* InProcessIDBServer::quotaManager(const ClientOrigin& origin)
 {
-    return m_quotaManagers.ensure(origin, [] {
-        return StorageQuotaManager::create(StorageQuotaManager::defaultQuota(), [] {
+    return m_quotaManagers.ensure(origin, [this, &origin]() -> Ref<StorageQuotaManager> {
+#if PLATFORM(JAVA)
+        // Databases persisted on disk are accounted against a fixed per-origin
+        // quota; requests that would exceed it are denied rather than granted.
+        if (!m_databaseDirectoryPath.isEmpty()) {
+            return StorageQuotaManager::create(m_perOriginQuota, [directory = m_databaseDirectoryPath.isolatedCopy(), origin = origin.isolatedCopy()] {
+                return IDBServer::IDBServer::diskUsage(directory, origin);
+            }, [](uint64_t, uint64_t, uint64_t, auto callback) {
+                callback(std::nullopt);
+            });
+        }
+#else
+        UNUSED_PARAM(origin);
+#endif
+        return StorageQuotaManager::create(m_perOriginQuota, [] {
             return 0;
         }, [](uint64_t quota, uint64_t currentSpace, uint64_t spaceIncrease, auto callback) {
             callback(quota + currentSpace + spaceIncrease);
@@ -81,6 +105,38 @@ StorageQuotaManager* InProcessIDBServer::quotaManager(const ClientOrigin& origin
     }).iterator->value.get();
 }
 
+#if PLATFORM(JAVA)
+static uint64_t databasesSizeUnderDirectory(const String& directory)
+{
+    uint64_t size = 0;
+    for (auto& name : FileSystem::listDirectory(directory)) {
+        auto path = FileSystem::pathByAppendingComponent(directory, name);
+        auto type = FileSystem::fileType(path);
+        if (type == FileSystem::FileType::Directory)
+            size += databasesSizeUnderDirectory(path);
+        else if (type == FileSystem::FileType::Regular && name.endsWith(".sqlite3"))
+            size += SQLiteFileSystem::databaseFileSize(path);
+    }
+    return size;
+}
+
+uint64_t InProcessIDBServer::diskUsage()
+{
+    ASSERT(isMainThread());
+    if (m_databaseDirectoryPath.isEmpty())
+        return 0;
+
+    uint64_t usage = 0;
+    BinarySemaphore semaphore;
+    dispatchTask([directory = m_databaseDirectoryPath.isolatedCopy(), &usage, &semaphore] {
+        usage = databasesSizeUnderDirectory(directory);
+        semaphore.signal();
+    });
+    semaphore.wait();
+    return usage;
+}
+#endif
+
 static inline IDBServer::IDBServer::StorageQuotaManagerSpaceRequester storageQuotaManagerSpaceRequester(InProcessIDBServer& server)
 {
     return [server = &server, weakServer = makeWeakPtr(server)](const ClientOrigin& origin, uint64_t spaceRequested) mutable {
@@ -89,8 +145,10 @@ static inline IDBServer::IDBServer::StorageQuotaManagerSpaceRequester storageQuo
     };
 }
 
-InProcessIDBServer::InProcessIDBServer(PAL::SessionID sessionID, const String& databaseDirectoryPath)
+InProcessIDBServer::InProcessIDBServer(PAL::SessionID sessionID, const String& databaseDirectoryPath, uint64_t perOriginQuota)
     : m_queue(WorkQueue::create("com.apple.WebKit.IndexedDBServer"))
+    , m_databaseDirectoryPath(databaseDirectoryPath)
+    , m_perOriginQuota(perOriginQuota)
 {
     ASSERT(isMainThread());
     m_connectionToServer = IDBClient::IDBConnectionToServer::create(*this);
@@ -28,6 +28,7 @@
 #include <WebCore/IDBConnectionToClient.h>
 #include <WebCore/IDBConnectionToServer.h>
 #include <WebCore/IDBServer.h>
+#include <WebCore/StorageQuotaManager.h>
 #include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
 #include <wtf/ThreadSafeRefCounted.h>
@@ -54,6 +55,9 @@ public:
 
     static Ref<InProcessIDBServer> create(PAL::SessionID);
     static Ref<InProcessIDBServer> create(PAL::SessionID, const String& databaseDirectoryPath);
+#if PLATFORM(JAVA)
+    static Ref<InProcessIDBServer> create(PAL::SessionID, const String& databaseDirectoryPath, uint64_t perOriginQuota);
+#endif
 
     virtual ~InProcessIDBServer();
 
@@ -122,14 +126,21 @@ public:
 
     WebCore::StorageQuotaManager* quotaManager(const WebCore::ClientOrigin&);
 
+#if PLATFORM(JAVA)
+    // Size in bytes of all databases stored under the database directory.
+    uint64_t diskUsage();
+#endif
+
 private:
-    InProcessIDBServer(PAL::SessionID, const String& databaseDirectoryPath = nullString());
+    InProcessIDBServer(PAL::SessionID, const String& databaseDirectoryPath = nullString(), uint64_t perOriginQuota = WebCore::StorageQuotaManager::defaultQuota());
 
     Lock m_serverLock;
     std::unique_ptr<WebCore::IDBServer::IDBServer> m_server;
     RefPtr<WebCore::IDBClient::IDBConnectionToServer> m_connectionToServer;
     RefPtr<WebCore::IDBServer::IDBConnectionToClient> m_connectionToClient;
     Ref<WorkQueue> m_queue;
+    String m_databaseDirectoryPath;
+    uint64_t m_perOriginQuota;
 
     HashMap<WebCore::ClientOrigin, RefPtr<WebCore::StorageQuotaManager>> m_quotaManagers;
 };
@@ -116,6 +116,10 @@ String StorageAreaImpl::key(unsigned index)
 String StorageAreaImpl::item(const String& key)
 {
     ASSERT(!m_isShutdown);
+
+    String value;
+    if (m_storageAreaSync && m_storageAreaSync->itemDuringImport(key, value))
+        return value;
     blockUntilImportComplete();
 
     return m_storageMap.getItem(key);
@@ -176,6 +180,10 @@ void StorageAreaImpl::clear(Frame* sourceFrame)
 bool StorageAreaImpl::contains(const String& key)
 {
     ASSERT(!m_isShutdown);
+
+    String value;
+    if (m_storageAreaSync && m_storageAreaSync->itemDuringImport(key, value))
+        return !value.isNull();
     blockUntilImportComplete();
 
     return m_storageMap.contains(key);
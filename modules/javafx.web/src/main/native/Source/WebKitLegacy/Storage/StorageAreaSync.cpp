@@ -28,6 +28,7 @@
 #include "StorageAreaImpl.h"
 #include "StorageSyncManager.h"
 #include "StorageTracker.h"
+#include <WebCore/Logging.h>
 #include <WebCore/SQLiteDatabaseTracker.h>
 #include <WebCore/SQLiteStatement.h>
 #include <WebCore/SQLiteTransaction.h>
@@ -45,7 +46,36 @@ static const Seconds StorageSyncInterval { 1_s };
 
 // A sane limit on how many items we'll schedule to sync all at once.  This makes it
 // much harder to starve the rest of LocalStorage and the OS's IO subsystem in general.
-static const int MaxiumItemsToSync = 100;
+// The database runs in WAL mode, so a single larger transaction is much cheaper than
+// several small ones spread over consecutive sync intervals.
+static const int MaxiumItemsToSync = 1000;
+
+// How many items the import reads before publishing them to the main thread and
+// serving any lookups that are waiting on a particular key.
+static const unsigned ImportChunkSize = 256;
+
+static std::atomic<uint64_t> importCount { 0 };
+static std::atomic<uint64_t> importedItemCount { 0 };
+static std::atomic<int64_t> importMicroseconds { 0 };
+static std::atomic<uint64_t> lookupDuringImportCount { 0 };
+static std::atomic<uint64_t> syncCount { 0 };
+static std::atomic<uint64_t> syncedItemCount { 0 };
+static std::atomic<uint64_t> largestSyncCount { 0 };
+static std::atomic<uint64_t> deferredItemCount { 0 };
+
+StorageAreaSync::Statistics StorageAreaSync::statistics()
+{
+    Statistics statistics;
+    statistics.imports = importCount;
+    statistics.importedItems = importedItemCount;
+    statistics.importTime = Seconds::fromMicroseconds(importMicroseconds.load());
+    statistics.lookupsDuringImport = lookupDuringImportCount;
+    statistics.syncs = syncCount;
+    statistics.syncedItems = syncedItemCount;
+    statistics.largestSync = largestSyncCount;
+    statistics.deferredItems = deferredItemCount;
+    return statistics;
+}
 
 inline StorageAreaSync::StorageAreaSync(RefPtr<StorageSyncManager>&& storageSyncManager, Ref<StorageAreaImpl>&& storageArea, const String& databaseIdentifier)
     : m_syncTimer(*this, &StorageAreaSync::syncTimerFired)
@@ -60,6 +90,8 @@ inline StorageAreaSync::StorageAreaSync(RefPtr<StorageSyncManager>&& storageSync
     , m_databaseOpenFailed(false)
     , m_syncCloseDatabase(false)
     , m_importComplete(false)
+    , m_importIndexComplete(false)
+    , m_importStartTime(MonotonicTime::now())
 {
     ASSERT(isMainThread());
     ASSERT(m_storageArea);
@@ -200,6 +232,9 @@ void StorageAreaSync::syncTimerFired()
             HashMap<String, String>::iterator pending_end = m_itemsPendingSync.end();
             for (; pending_it != pending_end; ++pending_it)
                 m_changedItems.remove(pending_it->key);
+
+            deferredItemCount += m_changedItems.size();
+            LOG(StorageAPI, "Local storage sync for %s deferred %u changed items", m_databaseIdentifier.utf8().data(), m_changedItems.size());
         }
 
         if (!m_syncScheduled) {
@@ -260,6 +295,11 @@ void StorageAreaSync::openDatabase(OpenDatabaseParamType openingStrategy)
         return;
     }
 
+    // The database is opened in WAL mode; a commit only needs to reach the log, which is
+    // durable enough for LocalStorage and avoids an fsync of the main file per sync.
+    if (!m_database.executeCommand("PRAGMA synchronous = NORMAL"_s))
+        LOG_ERROR("Failed to set synchronous mode for local storage database");
+
     migrateItemTableIfNeeded();
 
     if (!m_database.executeCommand("CREATE TABLE IF NOT EXISTS ItemTable (key TEXT UNIQUE ON CONFLICT REPLACE, value BLOB NOT NULL ON CONFLICT FAIL)"_s)) {
@@ -326,19 +366,50 @@ void StorageAreaSync::performImport()
         return;
     }
 
+    // Read the keys first. Once they are known, lookups of keys that are not in the
+    // database, or whose values have already been read, no longer wait for the import.
+    {
+        auto query = m_database.prepareStatement("SELECT key FROM ItemTable"_s);
+        if (!query) {
+            LOG_ERROR("Unable to select keys from ItemTable for local storage");
+            markImported();
+            return;
+        }
+
+        HashMap<String, String> index;
+
+        int result = query->step();
+        while (result == SQLITE_ROW) {
+            index.set(query->columnText(0), String());
+            result = query->step();
+        }
+
+        if (result != SQLITE_DONE) {
+            LOG_ERROR("Error reading keys from ItemTable for local storage");
+            markImported();
+            return;
+        }
+
+        Locker locker { m_importLock };
+        m_importedItems = WTFMove(index);
+        m_importIndexComplete = true;
+        m_importCondition.notifyAll();
+    }
+
     auto query = m_database.prepareStatement("SELECT key, value FROM ItemTable"_s);
-    if (!query) {
+    auto lookup = m_database.prepareStatement("SELECT value FROM ItemTable WHERE key=?"_s);
+    if (!query || !lookup) {
         LOG_ERROR("Unable to select items from ItemTable for local storage");
         markImported();
         return;
     }
 
-    HashMap<String, String> itemMap;
-
-    int result = query->step();
+    int result = SQLITE_ROW;
     while (result == SQLITE_ROW) {
-        itemMap.set(query->columnText(0), query->columnBlobAsString(1));
-        result = query->step();
+        HashMap<String, String> chunk;
+        while (chunk.size() < ImportChunkSize && (result = query->step()) == SQLITE_ROW)
+            chunk.set(query->columnText(0), query->columnBlobAsString(1));
+        importChunk(chunk, *lookup);
     }
 
     if (result != SQLITE_DONE) {
@@ -347,25 +418,108 @@ void StorageAreaSync::performImport()
         return;
     }
 
+    HashMap<String, String> itemMap;
+    {
+        Locker locker { m_importLock };
+        // Lookups wait for markImported() from here on, since the items move to the StorageMap.
+        m_importIndexComplete = false;
+        itemMap = WTFMove(m_importedItems);
+    }
+
+    Seconds importTime = MonotonicTime::now() - m_importStartTime;
+    importCount++;
+    importedItemCount += itemMap.size();
+    importMicroseconds += importTime.microsecondsAs<int64_t>();
+    LOG(StorageAPI, "Imported %u local storage items for %s in %.3fms", itemMap.size(), m_databaseIdentifier.utf8().data(), importTime.milliseconds());
+
     m_storageArea->importItems(WTFMove(itemMap));
 
     markImported();
 }
 
+void StorageAreaSync::importChunk(const HashMap<String, String>& items, SQLiteStatement& lookup)
+{
+    ASSERT(!isMainThread());
+
+    Vector<String> requests;
+    {
+        Locker locker { m_importLock };
+        for (auto& item : items)
+            m_importedItems.set(item.key, item.value);
+        requests = std::exchange(m_importRequests, { });
+        m_importCondition.notifyAll();
+    }
+
+    if (requests.isEmpty())
+        return;
+
+    // Read the keys the main thread is waiting on ahead of the rest of the table.
+    for (auto& key : requests) {
+        lookup.bindText(1, key);
+        if (lookup.step() == SQLITE_ROW) {
+            String value = lookup.columnBlobAsString(0);
+            Locker locker { m_importLock };
+            m_importedItems.set(key, value);
+        }
+        lookup.reset();
+    }
+
+    Locker locker { m_importLock };
+    m_importCondition.notifyAll();
+}
+
 void StorageAreaSync::markImported()
 {
     Locker locker { m_importLock };
     m_importComplete = true;
-    m_importCondition.notifyOne();
+    m_importIndexComplete = false;
+    m_importedItems.clear();
+    m_importRequests.clear();
+    m_importCondition.notifyAll();
+}
+
+// Returns true if |value| holds the item for |key| before the import has completed. Nothing can
+// modify the StorageArea until then, so the database contents read so far are authoritative.
+// Keys whose values have not been read yet are moved to the front of the import.
+bool StorageAreaSync::itemDuringImport(const String& key, String& value)
+{
+    ASSERT(isMainThread());
+
+    // Fast path. We set m_storageArea to 0 only after m_importComplete being true.
+    if (!m_storageArea)
+        return false;
+
+    Locker locker { m_importLock };
+    bool requested = false;
+    while (!m_importComplete) {
+        if (m_importIndexComplete) {
+            auto it = m_importedItems.find(key);
+            if (it == m_importedItems.end()) {
+                value = String();
+                lookupDuringImportCount++;
+                return true;
+            }
+            if (!it->value.isNull()) {
+                value = it->value.isolatedCopy();
+                lookupDuringImportCount++;
+                return true;
+            }
+            if (!requested) {
+                m_importRequests.append(key.isolatedCopy());
+                requested = true;
+            }
+        }
+        m_importCondition.wait(m_importLock);
+    }
+    return false;
 }
 
-// FIXME: In the future, we should allow use of StorageAreas while it's importing (when safe to do so).
-// Blocking everything until the import is complete is by far the simplest and safest thing to do, but
-// there is certainly room for safe optimization: Key/length will never be able to make use of such an
-// optimization (since the order of iteration can change as items are being added). Get can return any
-// item currently in the map. Get/remove can work whether or not it's in the map, but we'll need a list
-// of items the import should not overwrite. Clear can also work, but it'll need to kill the import
-// job first.
+// FIXME: In the future, we should allow more uses of StorageAreas while it's importing (when safe to do so).
+// Blocking everything but getItem/contains until the import is complete is by far the simplest and safest
+// thing to do, but there is certainly room for safe optimization: Key/length will never be able to make use
+// of such an optimization (since the order of iteration can change as items are being added). Set/remove
+// can work whether or not it's in the map, but we'll need a list of items the import should not overwrite.
+// Clear can also work, but it'll need to kill the import job first.
 void StorageAreaSync::blockUntilImportComplete()
 {
     ASSERT(isMainThread());
@@ -439,6 +593,13 @@ void StorageAreaSync::sync(bool clearItems, const HashMap<String, String>& items
 
     HashMap<String, String>::const_iterator end = items.end();
 
+    LOG(StorageAPI, "Syncing %u local storage items for %s%s", items.size(), m_databaseIdentifier.utf8().data(), clearItems ? " after clear" : "");
+
+    syncCount++;
+    syncedItemCount += items.size();
+    uint64_t largest = largestSyncCount;
+    while (items.size() > largest && !largestSyncCount.compare_exchange_weak(largest, items.size())) { }
+
     SQLiteTransaction transaction(m_database);
     transaction.begin();
     for (HashMap<String, String>::const_iterator it = items.begin(); it != end; ++it) {
@@ -30,9 +30,13 @@
 #include <wtf/Condition.h>
 #include <wtf/HashMap.h>
 #include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Seconds.h>
+#include <wtf/Vector.h>
 #include <wtf/text/StringHash.h>
 
 namespace WebCore {
+class SQLiteStatement;
 class StorageSyncManager;
 }
 
@@ -42,11 +46,29 @@ class StorageAreaImpl;
 
 class StorageAreaSync : public ThreadSafeRefCounted<StorageAreaSync, WTF::DestructionThread::Main> {
 public:
+    // Totals over all local storage areas of the process.
+    struct Statistics {
+        uint64_t imports { 0 };
+        uint64_t importedItems { 0 };
+        // From the creation of a storage area to the end of its import.
+        Seconds importTime;
+        // getItem()/contains() calls answered before their import completed.
+        uint64_t lookupsDuringImport { 0 };
+        uint64_t syncs { 0 };
+        uint64_t syncedItems { 0 };
+        uint64_t largestSync { 0 };
+        // Changed items left for a later sync because a batch was full.
+        uint64_t deferredItems { 0 };
+    };
+
+    static Statistics statistics();
+
     static Ref<StorageAreaSync> create(RefPtr<WebCore::StorageSyncManager>&&, Ref<StorageAreaImpl>&&, const String& databaseIdentifier);
     ~StorageAreaSync();
 
     void scheduleFinalSync();
     void blockUntilImportComplete();
+    bool itemDuringImport(const String& key, String& value);
 
     void scheduleItemForSync(const String& key, const String& value);
     void scheduleClear();
@@ -85,6 +107,7 @@ private:
     void syncTimerFired();
     void openDatabase(OpenDatabaseParamType openingStrategy);
     void sync(bool clearItems, const HashMap<String, String>& items);
+    void importChunk(const HashMap<String, String>& items, WebCore::SQLiteStatement& lookup);
 
     const String m_databaseIdentifier;
 
@@ -100,6 +123,12 @@ private:
     mutable Lock m_importLock;
     Condition m_importCondition;
     bool m_importComplete WTF_GUARDED_BY_LOCK(m_importLock);
+    // Items read so far by the import, keyed by every key in the database once
+    // m_importIndexComplete is set. A null value means it has not been read yet.
+    HashMap<String, String> m_importedItems WTF_GUARDED_BY_LOCK(m_importLock);
+    bool m_importIndexComplete WTF_GUARDED_BY_LOCK(m_importLock);
+    Vector<String> m_importRequests WTF_GUARDED_BY_LOCK(m_importLock);
+    MonotonicTime m_importStartTime;
     void markImported();
     void migrateItemTableIfNeeded();
 };
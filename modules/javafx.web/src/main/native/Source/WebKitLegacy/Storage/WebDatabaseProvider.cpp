@@ -45,7 +45,11 @@ WebDatabaseProvider::~WebDatabaseProvider()
 WebCore::IDBClient::IDBConnectionToServer& WebDatabaseProvider::idbConnectionToServerForSession(PAL::SessionID sessionID)
 {
     return m_idbServerMap.ensure(sessionID, [&sessionID] {
+#if PLATFORM(JAVA)
+        return sessionID.isEphemeral() ? InProcessIDBServer::create(sessionID) : InProcessIDBServer::create(sessionID, indexedDatabaseDirectoryPath(), indexedDatabasePerOriginQuota());
+#else
         return sessionID.isEphemeral() ? InProcessIDBServer::create(sessionID) : InProcessIDBServer::create(sessionID, indexedDatabaseDirectoryPath());
+#endif
     }).iterator->value->connectionToServer();
 }
 
@@ -41,10 +41,20 @@ public:
 
     void deleteAllDatabases();
 
+#if PLATFORM(JAVA)
+    // Returns whether databases are persisted under the given path.
+    bool setIndexedDatabaseDirectoryPath(const String&);
+    void setIndexedDatabasePerOriginQuota(uint64_t);
+    uint64_t indexedDatabaseDiskUsage();
+#endif
+
 private:
     explicit WebDatabaseProvider();
 
     static String indexedDatabaseDirectoryPath();
+#if PLATFORM(JAVA)
+    static uint64_t indexedDatabasePerOriginQuota();
+#endif
 
     HashMap<PAL::SessionID, RefPtr<InProcessIDBServer>> m_idbServerMap;
 };
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <WebCore/ContainerNode.h>
+#include <WebCore/Document.h>
+#include <WebCore/Element.h>
+#include <WebCore/JSExecState.h>
+#include <WebCore/NodeList.h>
+#include <WebCore/NodeTraversal.h>
+#include <WebCore/RenderObject.h>
+
+#include <wtf/HashMap.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
+
+#include <WebCore/JavaDOMUtils.h>
+#include <wtf/java/JavaEnv.h>
+
+using namespace WebCore;
+
+namespace {
+
+// Serializes a DOM subtree into the layout read by com.sun.webkit.dom.DOMSnapshot.
+// All values are native endian int32, float or UTF-16 code units:
+//
+//   header:  version, flags, nodeCount, stringCount
+//   strings: stringCount times { length, length UTF-16 code units }
+//   nodes:   nodeCount times, in document order,
+//            { nodeType, parentIndex, nameIndex, valueIndex, attributeCount,
+//              attributeCount times { nameIndex, valueIndex },
+//              [ x, y, width, height ] if FLAG_LAYOUT is set }
+//
+// Strings are shared through the string table; a missing string or parent
+// is -1. Boxes are in absolute document coordinates, NaN for nodes without a
+// renderer.
+class DOMSnapshotWriter {
+public:
+    static constexpr int32_t version = 1;
+    static constexpr int32_t flagLayout = 1;
+
+    explicit DOMSnapshotWriter(bool includeLayout)
+        : m_includeLayout(includeLayout)
+    {
+    }
+
+    void writeSubtree(Node& root)
+    {
+        HashMap<const Node*, int32_t> indices;
+        int32_t nodeCount = 0;
+        for (Node* node = &root; node; node = NodeTraversal::next(*node, &root)) {
+            indices.add(node, nodeCount++);
+            writeNode(*node, node == &root ? -1 : indices.get(node->parentNode()));
+        }
+        m_nodeCount = nodeCount;
+    }
+
+    Vector<uint8_t> finish()
+    {
+        Vector<uint8_t> result;
+        result.reserveInitialCapacity(4 * sizeof(int32_t) + m_strings.size() + m_nodes.size());
+        append(result, version);
+        append(result, m_includeLayout ? flagLayout : 0);
+        append(result, m_nodeCount);
+        append(result, m_stringCount);
+        result.append(m_strings.data(), m_strings.size());
+        result.append(m_nodes.data(), m_nodes.size());
+        return result;
+    }
+
+private:
+    template<typename T> static void append(Vector<uint8_t>& buffer, T value)
+    {
+        buffer.append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    int32_t stringIndex(const String& string)
+    {
+        if (string.isNull())
+            return -1;
+        auto result = m_stringIndices.add(string, m_stringCount);
+        if (!result.isNewEntry)
+            return result.iterator->value;
+
+        append(m_strings, static_cast<int32_t>(string.length()));
+        if (string.is8Bit()) {
+            const LChar* characters = string.characters8();
+            for (unsigned i = 0; i < string.length(); ++i)
+                append(m_strings, static_cast<UChar>(characters[i]));
+        } else
+            m_strings.append(reinterpret_cast<const uint8_t*>(string.characters16()), string.length() * sizeof(UChar));
+        return m_stringCount++;
+    }
+
+    void writeNode(Node& node, int32_t parentIndex)
+    {
+        append(m_nodes, static_cast<int32_t>(node.nodeType()));
+        append(m_nodes, parentIndex);
+
+        if (is<Element>(node)) {
+            auto& element = downcast<Element>(node);
+            append(m_nodes, stringIndex(element.tagName()));
+            append(m_nodes, static_cast<int32_t>(-1));
+            if (element.hasAttributes()) {
+                append(m_nodes, static_cast<int32_t>(element.attributeCount()));
+                for (const Attribute& attribute : element.attributesIterator()) {
+                    append(m_nodes, stringIndex(attribute.name().toString()));
+                    append(m_nodes, stringIndex(attribute.value()));
+                }
+            } else
+                append(m_nodes, static_cast<int32_t>(0));
+        } else {
+            append(m_nodes, stringIndex(node.nodeName()));
+            append(m_nodes, stringIndex(node.nodeValue()));
+            append(m_nodes, static_cast<int32_t>(0));
+        }
+
+        if (m_includeLayout) {
+            auto* renderer = node.renderer();
+            if (renderer) {
+                IntRect box = renderer->absoluteBoundingBoxRect();
+                append(m_nodes, static_cast<float>(box.x()));
+                append(m_nodes, static_cast<float>(box.y()));
+                append(m_nodes, static_cast<float>(box.width()));
+                append(m_nodes, static_cast<float>(box.height()));
+            } else {
+                for (int i = 0; i < 4; ++i)
+                    append(m_nodes, std::numeric_limits<float>::quiet_NaN());
+            }
+        }
+    }
+
+    bool m_includeLayout;
+    int32_t m_nodeCount { 0 };
+    int32_t m_stringCount { 0 };
+    HashMap<String, int32_t> m_stringIndices;
+    Vector<uint8_t> m_strings;
+    Vector<uint8_t> m_nodes;
+};
+
+} // namespace
+
+extern "C" {
+
+#define IMPL (static_cast<Node*>(jlong_to_ptr(peer)))
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_dom_NodeImpl_snapshotImpl(JNIEnv* env, jclass, jlong peer
+    , jboolean includeLayout)
+{
+    WebCore::JSMainThreadNullState state;
+    if (includeLayout)
+        IMPL->document().updateLayoutIgnorePendingStylesheets();
+
+    DOMSnapshotWriter writer(includeLayout);
+    writer.writeSubtree(*IMPL);
+    Vector<uint8_t> data = writer.finish();
+
+    jbyteArray result = env->NewByteArray(data.size());
+    if (!result)
+        return nullptr;
+    env->SetByteArrayRegion(result, 0, data.size(), reinterpret_cast<const jbyte*>(data.data()));
+    return result;
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_dom_NodeImpl_querySelectorAllPeersImpl(JNIEnv* env, jclass, jlong peer
+    , jstring selectors)
+{
+    WebCore::JSMainThreadNullState state;
+    if (!is<ContainerNode>(*IMPL)) {
+        raiseNotSupportedErrorException(env);
+        return nullptr;
+    }
+
+    RefPtr<NodeList> nodes = raiseOnDOMError(env, downcast<ContainerNode>(*IMPL).querySelectorAll(String(env, selectors)));
+    if (!nodes)
+        return nullptr;
+
+    unsigned length = nodes->length();
+    Vector<jlong> peers(length);
+    for (unsigned i = 0; i < length; ++i) {
+        //paired deref() call is in NodeImpl.dispose Java method.
+        Node* node = nodes->item(i);
+        node->ref();
+        peers[i] = ptr_to_jlong(node);
+    }
+
+    jlongArray result = env->NewLongArray(length);
+    if (!result) {
+        for (jlong nodePeer : peers)
+            static_cast<Node*>(jlong_to_ptr(nodePeer))->deref();
+        return nullptr;
+    }
+    env->SetLongArrayRegion(result, 0, length, peers.data());
+    return result;
+}
+
+#undef IMPL
+
+}
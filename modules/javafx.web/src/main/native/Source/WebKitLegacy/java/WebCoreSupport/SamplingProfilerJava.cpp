@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <JavaScriptCore/DeferGC.h>
+#include <JavaScriptCore/JITCode.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/SamplingProfiler.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/CommonVM.h>
+
+#include <wtf/HashMap.h>
+#include <wtf/Stopwatch.h>
+#include <wtf/Vector.h>
+#include <wtf/VectorHash.h>
+#include <wtf/text/StringHash.h>
+
+#include "com_sun_webkit_WebPage.h"
+
+using namespace WebCore;
+
+#if ENABLE(SAMPLING_PROFILER)
+
+namespace {
+
+using JSC::SamplingProfiler;
+
+// Aggregates sampled stack traces into the layout read by com.sun.webkit.ScriptProfile.
+// All values are native endian int32 or UTF-16 code units:
+//
+//   header:  version, sampleCount, stringCount, frameCount, stackCount
+//   strings: stringCount times { length, length UTF-16 code units }
+//   frames:  frameCount times
+//            { nameIndex, urlIndex, functionLine, line, column, tier }
+//   stacks:  stackCount times
+//            { sampleCount, depth, depth times frameIndex, innermost first }
+//
+// Identical frames and identical stacks are stored once. A missing string is
+// -1, as are the lines and column of frames without source information.
+class ScriptProfileWriter {
+public:
+    static constexpr int32_t version = 1;
+
+    // Must match com.sun.webkit.ScriptProfile.Tier.
+    enum class Tier : int32_t { Unknown, LLInt, Baseline, DFG, FTL, Host, Wasm, RegExp, Native };
+
+    explicit ScriptProfileWriter(JSC::VM& vm)
+        : m_vm(vm)
+    {
+    }
+
+    void addStackTrace(SamplingProfiler::StackTrace& stackTrace)
+    {
+        ++m_sampleCount;
+        if (stackTrace.frames.isEmpty())
+            return;
+
+        Vector<int32_t> stack;
+        stack.reserveInitialCapacity(stackTrace.frames.size());
+        for (auto& frame : stackTrace.frames)
+            stack.uncheckedAppend(frameIndex(frame));
+
+        auto result = m_stackSampleCounts.add(WTFMove(stack), 0);
+        if (result.isNewEntry)
+            m_stacks.append(result.iterator->key);
+        ++result.iterator->value;
+    }
+
+    Vector<uint8_t> finish()
+    {
+        Vector<uint8_t> result;
+        append(result, version);
+        append(result, m_sampleCount);
+        append(result, m_stringCount);
+        append(result, static_cast<int32_t>(m_frames.size() / frameFieldCount));
+        append(result, static_cast<int32_t>(m_stacks.size()));
+        result.append(m_strings.data(), m_strings.size());
+        for (int32_t value : m_frames)
+            append(result, value);
+        for (auto& stack : m_stacks) {
+            append(result, static_cast<int32_t>(m_stackSampleCounts.get(stack)));
+            append(result, static_cast<int32_t>(stack.size()));
+            for (int32_t index : stack)
+                append(result, index);
+        }
+        return result;
+    }
+
+private:
+    static constexpr size_t frameFieldCount = 6;
+
+    template<typename T> static void append(Vector<uint8_t>& buffer, T value)
+    {
+        buffer.append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    static Tier tier(const SamplingProfiler::StackFrame& frame)
+    {
+        switch (frame.frameType) {
+        case SamplingProfiler::FrameType::Executable: {
+            // An inlined frame runs in the tier of the code block it was inlined into.
+            auto jitType = frame.machineLocation ? frame.machineLocation->first.jitType : frame.semanticLocation.jitType;
+            switch (jitType) {
+            case JSC::JITType::InterpreterThunk:
+                return Tier::LLInt;
+            case JSC::JITType::BaselineJIT:
+                return Tier::Baseline;
+            case JSC::JITType::DFGJIT:
+                return Tier::DFG;
+            case JSC::JITType::FTLJIT:
+                return Tier::FTL;
+            case JSC::JITType::HostCallThunk:
+                return Tier::Host;
+            case JSC::JITType::None:
+                return Tier::Unknown;
+            }
+            return Tier::Unknown;
+        }
+        case SamplingProfiler::FrameType::Host:
+            return Tier::Host;
+        case SamplingProfiler::FrameType::Wasm:
+            return Tier::Wasm;
+        case SamplingProfiler::FrameType::RegExp:
+            return Tier::RegExp;
+        case SamplingProfiler::FrameType::C:
+            return Tier::Native;
+        case SamplingProfiler::FrameType::Unknown:
+            return Tier::Unknown;
+        }
+        return Tier::Unknown;
+    }
+
+    int32_t stringIndex(const String& string)
+    {
+        if (string.isNull())
+            return -1;
+        auto result = m_stringIndices.add(string, m_stringCount);
+        if (!result.isNewEntry)
+            return result.iterator->value;
+
+        append(m_strings, static_cast<int32_t>(string.length()));
+        if (string.is8Bit()) {
+            const LChar* characters = string.characters8();
+            for (unsigned i = 0; i < string.length(); ++i)
+                append(m_strings, static_cast<UChar>(characters[i]));
+        } else
+            m_strings.append(reinterpret_cast<const uint8_t*>(string.characters16()), string.length() * sizeof(UChar));
+        return m_stringCount++;
+    }
+
+    int32_t frameIndex(SamplingProfiler::StackFrame& frame)
+    {
+        bool hasExpressionInfo = frame.hasExpressionInfo();
+        Vector<int32_t> key {
+            stringIndex(frame.displayName(m_vm)),
+            stringIndex(frame.url()),
+            frame.functionStartLine(),
+            hasExpressionInfo ? static_cast<int32_t>(frame.lineNumber()) : -1,
+            hasExpressionInfo ? static_cast<int32_t>(frame.columnNumber()) : -1,
+            static_cast<int32_t>(tier(frame))
+        };
+        auto result = m_frameIndices.add(key, static_cast<int32_t>(m_frames.size() / frameFieldCount));
+        if (result.isNewEntry)
+            m_frames.appendVector(key);
+        return result.iterator->value;
+    }
+
+    JSC::VM& m_vm;
+    int32_t m_sampleCount { 0 };
+    int32_t m_stringCount { 0 };
+    HashMap<String, int32_t> m_stringIndices;
+    Vector<uint8_t> m_strings;
+    HashMap<Vector<int32_t>, int32_t> m_frameIndices;
+    Vector<int32_t> m_frames;
+    HashMap<Vector<int32_t>, unsigned> m_stackSampleCounts;
+    Vector<Vector<int32_t>> m_stacks;
+};
+
+} // namespace
+
+#endif // ENABLE(SAMPLING_PROFILER)
+
+extern "C" {
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkStartSamplingProfiler
+    (JNIEnv*, jclass, jint intervalMicros)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+
+    auto stopwatch = Stopwatch::create();
+    stopwatch->start();
+
+    auto& samplingProfiler = vm.ensureSamplingProfiler(stopwatch.copyRef());
+    samplingProfiler.setTimingInterval(Seconds::fromMicroseconds(intervalMicros));
+
+    Locker locker { samplingProfiler.getLock() };
+    samplingProfiler.clearData();
+    samplingProfiler.setStopWatch(WTFMove(stopwatch));
+    samplingProfiler.noticeCurrentThreadAsJSCExecutionThreadWithLock();
+    samplingProfiler.startWithLock();
+    return JNI_TRUE;
+#else
+    UNUSED_PARAM(intervalMicros);
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_WebPage_twkStopSamplingProfiler
+    (JNIEnv* env, jclass)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    // The released stack traces hold raw pointers into the heap.
+    JSC::DeferGC deferGC(vm.heap);
+
+    auto* samplingProfiler = vm.samplingProfiler();
+    if (!samplingProfiler)
+        return nullptr;
+
+    Locker locker { samplingProfiler->getLock() };
+    samplingProfiler->pause();
+    auto stackTraces = samplingProfiler->releaseStackTraces();
+    locker.unlockEarly();
+
+    ScriptProfileWriter writer(vm);
+    for (auto& stackTrace : stackTraces)
+        writer.addStackTrace(stackTrace);
+    Vector<uint8_t> data = writer.finish();
+
+    jbyteArray result = env->NewByteArray(data.size());
+    if (!result)
+        return nullptr;
+    env->SetByteArrayRegion(result, 0, data.size(), reinterpret_cast<const jbyte*>(data.data()));
+    return result;
+#else
+    UNUSED_PARAM(env);
+    return nullptr;
+#endif
+}
+
+}
@@ -42,6 +42,7 @@
 #include "PlatformStrategiesJava.h"
 #include "ProgressTrackerClientJava.h"
 #include "VisitedLinkStoreJava.h"
+#include "WebKitLegacy/Storage/StorageAreaSync.h"
 #include "WebKitLegacy/Storage/StorageNamespaceImpl.h"
 #include "WebKitLegacy/Storage/WebDatabaseProvider.h"
 #include "WebKitVersion.h" //generated
@@ -53,11 +54,15 @@
 #include <JavaScriptCore/JSContextRefPrivate.h>
 #include <JavaScriptCore/JSStringRef.h>
 #include <JavaScriptCore/Options.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/BackForwardCache.h>
 #include <WebCore/BackForwardController.h>
 #include <WebCore/BridgeUtils.h>
+#include <WebCore/BytecodeCacheJava.h>
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
+#include <WebCore/CommonVM.h>
 #include <WebCore/CompositionHighlight.h>
 #include <WebCore/ContextMenu.h>
 #include <WebCore/ContextMenuController.h>
@@ -72,6 +77,7 @@
 #include <WebCore/FloatRect.h>
 #include <WebCore/FloatSize.h>
 #include <WebCore/FocusController.h>
+#include <WebCore/FontCache.h>
 #include <WebCore/Frame.h>
 #include <WebCore/FrameLoadRequest.h>
 #include <WebCore/FrameTree.h>
@@ -83,6 +89,8 @@
 #include <WebCore/InspectorController.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/LogInitialization.h>
+#include <WebCore/MemoryCache.h>
+#include <WebCore/MemoryRelease.h>
 #include <WebCore/NodeTraversal.h>
 #include <WebCore/Page.h>
 #include <WebCore/PageConfiguration.h>
@@ -824,6 +832,7 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
 bool s_useCSS3D;
 
 }  // namespace
@@ -831,9 +840,10 @@ bool s_useCSS3D;
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useCSS3D) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
     s_useCSS3D = useCSS3D;
 }
 
@@ -863,6 +873,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+#if ENABLE(FTL_JIT)
+        // FTL sits on top of DFG, so it needs both lower tiers.
+        JSC::Options::useFTLJIT() = s_useJIT && s_useDFGJIT && s_useFTLJIT;
+#endif
     });
 
     JLObject jlself(self, true);
@@ -917,6 +931,8 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
     settings.setUserAgent(defaultUserAgent());
     settings.setMaximumHTMLParserDOMTreeDepth(180);
     settings.setXSSAuditorEnabled(true);
+    settings.setSpeculativeHTMLTokenizationEnabled(false);
+    settings.setFastPathStyleInheritanceEnabled(true);
     settings.setInteractiveFormValidationEnabled(true);
 
     /* Using java logical fonts as defaults */
@@ -1310,6 +1326,10 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkOverridePreference
         settings.setMaximumHTMLParserDOMTreeDepth(parseIntegerAllowingTrailingJunk<uint32_t>(nativePropertyString).value());
     } else if (nativePropertyName == "WebKitXSSAuditorEnabled")  {
         settings.setXSSAuditorEnabled(parseIntegerAllowingTrailingJunk<int>(nativePropertyString).value());
+    } else if (nativePropertyName == "SpeculativeHTMLTokenizationEnabled") {
+        settings.setSpeculativeHTMLTokenizationEnabled(nativePropertyValue == "true");
+    } else if (nativePropertyName == "FastPathStyleInheritanceEnabled") {
+        settings.setFastPathStyleInheritanceEnabled(nativePropertyValue == "true");
     } else if (nativePropertyName == "WebKitSerifFontFamily") {
         settings.setSerifFontFamily(nativePropertyValue);
     } else if (nativePropertyName == "WebKitSansSerifFontFamily") {
@@ -2408,6 +2428,108 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
     settings.setLocalStorageEnabled(jbool_to_bool(enabled));
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabasePath
+  (JNIEnv* env, jobject, jlong, jstring path)
+{
+    return bool_to_jbool(WebDatabaseProvider::singleton().setIndexedDatabaseDirectoryPath(String(env, path)));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabaseQuota
+  (JNIEnv*, jclass, jlong quota)
+{
+    WebDatabaseProvider::singleton().setIndexedDatabasePerOriginQuota(static_cast<uint64_t>(quota));
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkGetIndexedDatabaseUsage
+  (JNIEnv*, jclass)
+{
+    return static_cast<jlong>(WebDatabaseProvider::singleton().indexedDatabaseDiskUsage());
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCachePath
+  (JNIEnv* env, jclass, jstring path)
+{
+    return bool_to_jbool(BytecodeCacheJava::setDirectory(path ? String(env, path) : String()));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetWarmUpProfileEnabled
+  (JNIEnv*, jclass, jboolean enabled)
+{
+    BytecodeCacheJava::setWarmUpProfileEnabled(jbool_to_bool(enabled));
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetBytecodeCacheStatistics
+  (JNIEnv* env, jclass)
+{
+    auto statistics = BytecodeCacheJava::statistics();
+    jlong values[] = {
+        static_cast<jlong>(statistics.hits),
+        static_cast<jlong>(statistics.misses),
+        static_cast<jlong>(statistics.stores),
+        static_cast<jlong>(statistics.bytesLoaded),
+        static_cast<jlong>(statistics.bytesStored),
+        statistics.savedGenerationTime.microsecondsAs<jlong>(),
+        static_cast<jlong>(statistics.warmUpProfilesLoaded),
+        static_cast<jlong>(statistics.warmUpProfilesStored),
+        static_cast<jlong>(statistics.warmUpHints),
+        static_cast<jlong>(statistics.warmUpTierUps),
+        static_cast<jlong>(statistics.coldScripts),
+        statistics.coldTimeToSteadyState.microsecondsAs<jlong>(),
+        static_cast<jlong>(statistics.warmScripts),
+        statistics.warmTimeToSteadyState.microsecondsAs<jlong>()
+    };
+    jlongArray result = env->NewLongArray(WTF_ARRAY_LENGTH(values));
+    env->SetLongArrayRegion(result, 0, WTF_ARRAY_LENGTH(values), values);
+    return result;
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetLocalStorageStatistics
+  (JNIEnv* env, jclass)
+{
+    auto statistics = WebKit::StorageAreaSync::statistics();
+    jlong values[] = {
+        static_cast<jlong>(statistics.imports),
+        static_cast<jlong>(statistics.importedItems),
+        statistics.importTime.microsecondsAs<jlong>(),
+        static_cast<jlong>(statistics.lookupsDuringImport),
+        static_cast<jlong>(statistics.syncs),
+        static_cast<jlong>(statistics.syncedItems),
+        static_cast<jlong>(statistics.largestSync),
+        static_cast<jlong>(statistics.deferredItems)
+    };
+    jlongArray result = env->NewLongArray(WTF_ARRAY_LENGTH(values));
+    env->SetLongArrayRegion(result, 0, WTF_ARRAY_LENGTH(values), values);
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkReleaseMemory
+  (JNIEnv*, jclass, jboolean critical)
+{
+    if (jbool_to_bool(critical))
+        WebCore::releaseMemory(Critical::Yes, Synchronous::Yes);
+    else
+        WebCore::releaseMemory(Critical::No, Synchronous::No);
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetMemoryStatistics
+  (JNIEnv* env, jclass)
+{
+    auto& memoryCache = MemoryCache::singleton();
+    auto& heap = commonVM().heap;
+    jlong values[] = {
+        static_cast<jlong>(memoryCache.size()),
+        static_cast<jlong>(memoryCache.getStatistics().images.decodedSize),
+        static_cast<jlong>(BackForwardCache::singleton().pageCount()),
+        static_cast<jlong>(heap.size()),
+        static_cast<jlong>(heap.extraMemorySize()),
+        static_cast<jlong>(FontCache::singleton().fontCount()),
+        static_cast<jlong>(FontCache::singleton().inactiveFontCount())
+    };
+    jlongArray result = env->NewLongArray(WTF_ARRAY_LENGTH(values));
+    env->SetLongArrayRegion(result, 0, WTF_ARRAY_LENGTH(values), values);
+    return result;
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkGetDeveloperExtrasEnabled
   (JNIEnv *, jobject, jlong pPage)
 {
@@ -2486,6 +2608,16 @@ JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkWorkerThreadCount
     return WorkerThread::workerThreadCount();
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkIsFTLJITEnabled
+  (JNIEnv*, jclass)
+{
+#if ENABLE(FTL_JIT)
+    return bool_to_jbool(JSC::Options::useFTLJIT());
+#else
+    return JNI_FALSE;
+#endif
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
   (JNIEnv*, jclass)
 {
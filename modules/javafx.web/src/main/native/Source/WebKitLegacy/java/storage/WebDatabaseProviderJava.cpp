@@ -25,7 +25,51 @@
 
 #include "WebDatabaseProvider.h"
 
+#include <WebCore/StorageQuotaManager.h>
+#include <pal/SessionID.h>
+#include <wtf/NeverDestroyed.h>
+
+static String& databaseDirectoryPath()
+{
+    static NeverDestroyed<String> path;
+    return path;
+}
+
+static uint64_t s_perOriginQuota = WebCore::StorageQuotaManager::defaultQuota();
+
 String WebDatabaseProvider::indexedDatabaseDirectoryPath()
 {
-    return "";
+    return databaseDirectoryPath();
+}
+
+uint64_t WebDatabaseProvider::indexedDatabasePerOriginQuota()
+{
+    return s_perOriginQuota;
+}
+
+bool WebDatabaseProvider::setIndexedDatabaseDirectoryPath(const String& path)
+{
+    ASSERT(isMainThread());
+    // The server of a session is bound to its directory once created,
+    // and open connections keep referring to it, so the path is fixed
+    // by the first WebEngine that applies its user data directory.
+    if (!databaseDirectoryPath().isEmpty())
+        return databaseDirectoryPath() == path;
+    if (m_idbServerMap.contains(PAL::SessionID::defaultSessionID()))
+        return false;
+    databaseDirectoryPath() = path.isolatedCopy();
+    return true;
+}
+
+void WebDatabaseProvider::setIndexedDatabasePerOriginQuota(uint64_t quota)
+{
+    ASSERT(isMainThread());
+    s_perOriginQuota = quota;
+}
+
+uint64_t WebDatabaseProvider::indexedDatabaseDiskUsage()
+{
+    ASSERT(isMainThread());
+    auto server = m_idbServerMap.get(PAL::SessionID::defaultSessionID());
+    return server ? server->diskUsage() : 0;
 }
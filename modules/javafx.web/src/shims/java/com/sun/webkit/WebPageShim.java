@@ -43,6 +43,18 @@ public class WebPageShim {
         return page.test_getFramesCount();
     }
 
+    public static void restoreAll(WebPage page) {
+        page.test_restoreAll();
+    }
+
+    public static void setDisplayListCacheEnabled(WebPage page, boolean enabled) {
+        page.test_setDisplayListCacheEnabled(enabled);
+    }
+
+    public static boolean isFTLJITEnabled() {
+        return WebPage.test_isFTLJITEnabled();
+    }
+
     private static WCGraphicsContext setupPageWithGraphics(WebPage page, int x, int y, int w, int h) {
         page.setBounds(x, y, w, h);
         // forces layout and renders the page into RenderQueue.
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.webkit.prism;
+
+import com.sun.javafx.webkit.prism.WCImageDecoderImplShim;
+import com.sun.webkit.graphics.WCImageDecoder;
+import java.awt.image.BufferedImage;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.Arrays;
+import java.util.Random;
+import javax.imageio.ImageIO;
+import org.junit.After;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+public class WCImageDecoderImplTest {
+
+    private final WCImageDecoderImplShim decoder = new WCImageDecoderImplShim();
+
+    @After
+    public void after() {
+        decoder.destroy();
+    }
+
+    private static byte[] createPNG(int width, int height) throws IOException {
+        final Random random = new Random(width * 31 + height);
+        final BufferedImage img = new BufferedImage(width, height, BufferedImage.TYPE_INT_RGB);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                img.setRGB(x, y, random.nextInt());
+            }
+        }
+        final ByteArrayOutputStream out = new ByteArrayOutputStream();
+        ImageIO.write(img, "png", out);
+        return out.toByteArray();
+    }
+
+    private static long decodeCount() {
+        return Arrays.stream(WCImageDecoder.getDecodeTimeHistogram()).sum();
+    }
+
+    private void addAllData(byte[] data) {
+        decoder.addImageData(data);
+        decoder.addImageData(null);
+    }
+
+    @Test public void testDecodeIsRecordedInHistogram() throws IOException {
+        final long before = decodeCount();
+        addAllData(createPNG(32, 16));
+
+        assertTrue("Frame should decode", decoder.decodeFrame(0));
+        assertEquals(1, decoder.getFrameCount());
+        assertEquals(before + 1, decodeCount());
+
+        // The frames are decoded only once
+        assertTrue(decoder.decodeFrame(0));
+        assertEquals(before + 1, decodeCount());
+    }
+
+    @Test public void testHistogramIsACopy() {
+        final long[] histogram = WCImageDecoder.getDecodeTimeHistogram();
+        assertEquals(12, histogram.length);
+        Arrays.fill(histogram, -1);
+        for (long count : WCImageDecoder.getDecodeTimeHistogram()) {
+            assertTrue("Bucket count should not be negative: " + count, count >= 0);
+        }
+    }
+
+    @Test public void testFrameCountDoesNotDecodeSingleFrameImage() throws IOException {
+        final long before = decodeCount();
+        addAllData(createPNG(32, 16));
+
+        final int[] size = decoder.getImageSize();
+        assertEquals(32, size[0]);
+        assertEquals(16, size[1]);
+        assertEquals(1, decoder.getFrameCount());
+        assertEquals(before, decodeCount());
+    }
+
+    @Test public void testFrameCountOfUndecodableData() {
+        final byte[] garbage = new byte[1024];
+        new Random(42).nextBytes(garbage);
+        addAllData(garbage);
+
+        assertEquals(0, decoder.getFrameCount());
+        assertFalse(decoder.decodeFrame(0));
+        assertEquals(0, decoder.getFrameCount());
+    }
+
+    @Test public void testFrameCountAfterFailedDecode() throws IOException {
+        final byte[] png = createPNG(64, 64);
+        // The header is intact, so the image size is known, but the
+        // image data ends half way through
+        addAllData(Arrays.copyOf(png, png.length / 2));
+        final int[] size = decoder.getImageSize();
+        assertEquals(64, size[0]);
+        assertEquals(64, size[1]);
+
+        final long before = decodeCount();
+        assertFalse("Truncated image should not decode", decoder.decodeFrame(0));
+        assertEquals(before + 1, decodeCount());
+        assertEquals(0, decoder.getFrameCount());
+
+        // A failed decode is not repeated
+        assertFalse(decoder.decodeFrame(0));
+        assertEquals(before + 1, decodeCount());
+    }
+}
@@ -34,6 +34,10 @@ import com.sun.webkit.WebPageShim;
 import java.awt.image.BufferedImage;
 import java.awt.Color;
 import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
 import javafx.concurrent.Worker.State;
 import javafx.scene.Scene;
 import javafx.scene.text.FontSmoothingType;
@@ -358,4 +362,170 @@ public class CSSTest extends TestBase {
             assertFalse("Color should not be blue:" + pixelAt199x199, isColorsSimilar(Color.BLUE, pixelAt199x199, 1));
         });
     }
+
+    // A scaled and offset background image is drawn through the
+    // DRAWPATTERN command, which carries the pattern transform inline.
+    @Test public void testBackgroundPatternTransformRendering() {
+        loadContent(
+                "<!DOCTYPE html>\n" +
+                "<html>\n" +
+                "  <body style='margin: 0px 0px;'>\n" +
+                "    <div style='width: 100px; height: 20px;\n" +
+                "                image-rendering: pixelated;\n" +
+                "                background-size: 20px 20px;\n" +
+                "                background-position: 10px 0px;\n" +
+                "                background-image: url(data:image/png;base64," +
+                "iVBORw0KGgoAAAANSUhEUgAAAAIAAAACCAIAAAD91JpzAAAAEElEQVR4nGP4zwAE/xkgFAAb8gP91pbyKwAAAABJRU5ErkJggg==);'>\n" +
+                "    </div>\n" +
+                "  </body>\n" +
+                "</html>"
+        );
+        submit(() -> {
+            final WebPage webPage = WebEngineShim.getPage(getEngine());
+            assertNotNull(webPage);
+            final BufferedImage img = WebPageShim.paint(webPage, 0, 0, 800, 600);
+            assertNotNull(img);
+
+            // The 2x2 image has a red left column and a blue right column
+            final Color pixelAt5x5 = new Color(img.getRGB(5, 5), true);
+            assertTrue("Color should be opaque blue:" + pixelAt5x5, isColorsSimilar(Color.BLUE, pixelAt5x5, 1));
+            final Color pixelAt15x5 = new Color(img.getRGB(15, 5), true);
+            assertTrue("Color should be opaque red:" + pixelAt15x5, isColorsSimilar(Color.RED, pixelAt15x5, 1));
+            final Color pixelAt25x15 = new Color(img.getRGB(25, 15), true);
+            assertTrue("Color should be opaque blue:" + pixelAt25x15, isColorsSimilar(Color.BLUE, pixelAt25x15, 1));
+            final Color pixelAt35x15 = new Color(img.getRGB(35, 15), true);
+            assertTrue("Color should be opaque red:" + pixelAt35x15, isColorsSimilar(Color.RED, pixelAt35x15, 1));
+            final Color pixelAt15x25 = new Color(img.getRGB(15, 25), true);
+            assertFalse("Color should not be red:" + pixelAt15x25, isColorsSimilar(Color.RED, pixelAt15x25, 1));
+        });
+    }
+
+    // Sheets of 128K characters or more are tokenized on a background
+    // thread. The load event must still wait for them to apply.
+    @Test public void testLargeStyleSheetAppliesBeforeLoadEvent() throws IOException {
+        final Path dir = Files.createTempDirectory("largestylesheet");
+        try {
+            final StringBuilder css = new StringBuilder();
+            int rules = 0;
+            while (css.length() < 256 * 1024) {
+                css.append(".filler").append(rules).append(" { color: rgb(1, 2, 3); margin: ")
+                        .append(rules % 10).append("px; }\n");
+                rules++;
+            }
+            css.append("#target { color: rgb(0, 128, 0); width: 123px; }\n");
+            rules++;
+            final Path sheet = dir.resolve("large.css");
+            Files.write(sheet, css.toString().getBytes(StandardCharsets.UTF_8));
+
+            final Path page = dir.resolve("large.html");
+            Files.write(page, (
+                    "<!DOCTYPE html>\n" +
+                    "<html>\n" +
+                    "  <head>\n" +
+                    "    <link id='sheet' rel='stylesheet' href='large.css'>\n" +
+                    "    <script>\n" +
+                    // Nothing here may force style resolution, which would
+                    // deliver the sheet synchronously. link.sheet stays null
+                    // until the sheet has been delivered.
+                    "      window.addEventListener('load', function() {\n" +
+                    "        var sheet = document.getElementById('sheet').sheet;\n" +
+                    "        document.title = sheet ? String(sheet.cssRules.length) : 'no sheet';\n" +
+                    "      });\n" +
+                    "    </script>\n" +
+                    "  </head>\n" +
+                    "  <body>\n" +
+                    "    <div id='target'>A</div>\n" +
+                    "  </body>\n" +
+                    "</html>").getBytes(StandardCharsets.UTF_8));
+
+            load(page.toFile());
+            assertEquals("Loading large stylesheet", SUCCEEDED, getLoadState());
+            assertEquals("Rules when the load event fired",
+                    String.valueOf(rules), executeScript("document.title"));
+            assertEquals("rgb(0, 128, 0);123px", executeScript(
+                    "var s = getComputedStyle(document.getElementById('target'));" +
+                    "s.color + ';' + s.width"));
+        } finally {
+            for (File f : dir.toFile().listFiles()) {
+                f.delete();
+            }
+            dir.toFile().delete();
+        }
+    }
+
+    /**
+     * Loads a page whose body color changes from red to blue when the body
+     * gets the class "blue", toggles the class after the first layout and
+     * returns the result of {@code query}.
+     */
+    private String recolorBody(boolean fastPath, String style, String body, String query) {
+        submit(() -> {
+            WebEngineShim.getPage(getEngine()).overridePreference(
+                    "FastPathStyleInheritanceEnabled", Boolean.toString(fastPath));
+        });
+        loadContent(
+                "<html><head><style>\n" +
+                "  body { color: rgb(255, 0, 0); }\n" +
+                "  body.blue { color: rgb(0, 0, 255); }\n" +
+                style +
+                "</style></head>\n" +
+                "<body>" + body + "</body></html>");
+        assertEquals("Loading recolor page", SUCCEEDED, getLoadState());
+        return (String) executeScript(
+                "document.body.offsetWidth;" +
+                "document.body.className = 'blue';" +
+                "document.body.offsetWidth;" +
+                query);
+    }
+
+    private void testRecolor(String style, String body, String query, String expected) {
+        final String resolved = recolorBody(false, style, body, query);
+        assertEquals("Full style resolution", expected, resolved);
+        assertEquals("Inherited color fast path", resolved, recolorBody(true, style, body, query));
+    }
+
+    @Test public void testRecolorCurrentColorBoxShadowAndBorder() {
+        testRecolor(
+                "  #target { box-shadow: 2px 2px 3px; border: 1px solid currentColor; }\n",
+                "<div><div id='target'>A</div></div>",
+                "var s = getComputedStyle(document.getElementById('target'));" +
+                "s.color + ';' + s.boxShadow + ';' + s.borderTopColor",
+                "rgb(0, 0, 255);rgb(0, 0, 255) 2px 2px 3px 0px;rgb(0, 0, 255)");
+    }
+
+    @Test public void testRecolorSVGFillCurrentColor() {
+        testRecolor(
+                "  rect { fill: currentColor; stroke: currentColor; }\n",
+                "<svg width='20' height='20'><g><rect id='target' width='20' height='20'/></g></svg>",
+                "var s = getComputedStyle(document.getElementById('target'));" +
+                "s.fill + ';' + s.stroke",
+                "rgb(0, 0, 255);rgb(0, 0, 255)");
+    }
+
+    @Test public void testRecolorPseudoElements() {
+        testRecolor(
+                "  #target::before { content: 'B'; border: 1px solid currentColor; }\n" +
+                "  #target::after { content: 'A'; box-shadow: 1px 1px; }\n",
+                "<div><span id='target'>T</span></div>",
+                "var t = document.getElementById('target');" +
+                "var b = getComputedStyle(t, '::before');" +
+                "var a = getComputedStyle(t, '::after');" +
+                "b.color + ';' + b.borderTopColor + ';' + a.color + ';' + a.boxShadow",
+                "rgb(0, 0, 255);rgb(0, 0, 255);rgb(0, 0, 255);rgb(0, 0, 255) 1px 1px 0px 0px");
+    }
+
+    @Test public void testRecolorThenInsertSiblings() {
+        testRecolor(
+                "  p:last-child { margin-left: 5px; }\n" +
+                "  p:nth-child(2) { padding-top: 7px; }\n",
+                "<p id='a'>A</p><p id='b'>B</p>",
+                "var a = document.getElementById('a');" +
+                "var b = document.getElementById('b');" +
+                "var last = document.body.appendChild(document.createElement('p'));" +
+                "document.body.insertBefore(document.createElement('p'), a);" +
+                "var sa = getComputedStyle(a), sb = getComputedStyle(b);" +
+                "sb.color + ';' + sb.marginLeft + ';' + sa.paddingTop + ';' +" +
+                " sb.paddingTop + ';' + getComputedStyle(last).marginLeft",
+                "rgb(0, 0, 255);0px;7px;0px;5px");
+    }
 }
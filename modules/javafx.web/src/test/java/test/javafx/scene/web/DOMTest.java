@@ -435,6 +435,46 @@ public class DOMTest extends TestBase {
         });
     }
 
+    @Test public void testSnapshot() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            Element p1 = doc.getElementById("p1");
+            DOMSnapshot snapshot = ((NodeImpl) p1).snapshot(true);
+
+            assertEquals("Root type", Node.ELEMENT_NODE, snapshot.getNodeType(0));
+            assertEquals("Root parent", -1, snapshot.getParent(0));
+            assertEquals("Root name", p1.getTagName(), snapshot.getNodeName(0));
+            assertEquals("Root attribute count",
+                    p1.getAttributes().getLength(), snapshot.getAttributeCount(0));
+            assertEquals("Root id", "p1", snapshot.getAttributeValue(0, 0));
+            assertNotNull("Root bounds", snapshot.getBounds(0));
+
+            NodeList children = p1.getChildNodes();
+            int child = 0;
+            for (int i = 1; i < snapshot.getNodeCount(); i++) {
+                if (snapshot.getParent(i) != 0) {
+                    continue;
+                }
+                Node n = children.item(child++);
+                assertEquals("Child type", n.getNodeType(), snapshot.getNodeType(i));
+                assertEquals("Child value", n.getNodeValue(), snapshot.getNodeValue(i));
+            }
+            assertEquals("Children count", children.getLength(), child);
+        });
+    }
+
+    @Test public void testQuerySelectorAllNodes() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            NodeList expected = doc.getElementsByTagName("p");
+            Node[] nodes = ((NodeImpl) doc).querySelectorAllNodes("p");
+            assertEquals("Number of nodes", expected.getLength(), nodes.length);
+            for (int i = 0; i < nodes.length; i++) {
+                assertSame("Node " + i, expected.item(i), nodes[i]);
+            }
+        });
+    }
+
     // helper methods
 
     private void verifyChildRemoved(Node parent,
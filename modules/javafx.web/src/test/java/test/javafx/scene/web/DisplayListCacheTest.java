@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.WCRectangle;
+import javafx.scene.web.WebEngineShim;
+import static org.junit.Assert.assertEquals;
+import org.junit.Before;
+import org.junit.Test;
+
+public class DisplayListCacheTest extends TestBase {
+
+    // 512x512 viewport, so four 256x256 tiles
+    private static final int SIZE = 512;
+    private static final int TILES = 4;
+
+    private WebPage page;
+
+    @Before public void setup() {
+        page = WebEngineShim.getPage(getEngine());
+        // The property is read once per process, so enable the cache for
+        // this page only.
+        submit(() -> WebPageShim.setDisplayListCacheEnabled(page, true));
+        loadContent("<html><body style='margin:0'>"
+                + "<div id='small' style='position:absolute;left:10px;top:10px;"
+                + "width:20px;height:20px;background:red'></div>"
+                + "<div style='position:absolute;left:300px;top:300px;"
+                + "width:100px;height:100px;background:blue'></div>"
+                + "</body></html>");
+        submit(() -> page.setBounds(0, 0, SIZE, SIZE));
+        paint();
+    }
+
+    // Paints like a pulse would, until layout leaves nothing dirty
+    private void paint() {
+        submit(() -> {
+            for (int i = 0; i < 5 && page.isDirty(); i++) {
+                page.updateContent(new WCRectangle(0, 0, SIZE, SIZE));
+            }
+        });
+    }
+
+    private void restoreAndPaint() {
+        submit(() -> WebPageShim.restoreAll(page));
+        paint();
+    }
+
+    @Test public void testUnchangedTilesAreReplayed() {
+        long replayed = page.getReplayedTileCount();
+        long repainted = page.getRepaintedTileCount();
+
+        restoreAndPaint();
+
+        assertEquals("Replayed tiles", replayed + TILES, page.getReplayedTileCount());
+        assertEquals("Repainted tiles", repainted, page.getRepaintedTileCount());
+    }
+
+    @Test public void testSmallInvalidationRepaintsOneTile() {
+        long replayed = page.getReplayedTileCount();
+        long repainted = page.getRepaintedTileCount();
+
+        executeScript("document.getElementById('small').style.background = 'green'");
+        paint();
+
+        // Only the tile under the changed element is painted again
+        assertEquals("Repainted tiles", repainted + 1, page.getRepaintedTileCount());
+        assertEquals("Replayed tiles", replayed, page.getReplayedTileCount());
+
+        // and all tiles, including the new recording, can be replayed
+        restoreAndPaint();
+        assertEquals("Repainted tiles", repainted + 1, page.getRepaintedTileCount());
+        assertEquals("Replayed tiles", replayed + TILES, page.getReplayedTileCount());
+    }
+
+    @Test public void testReleaseMemoryDropsTiles() {
+        long replayed = page.getReplayedTileCount();
+        long repainted = page.getRepaintedTileCount();
+
+        WebPage.releaseMemory(WebPage.MEMORY_PRESSURE_MODERATE);
+        restoreAndPaint();
+
+        assertEquals("Replayed tiles", replayed, page.getReplayedTileCount());
+        assertEquals("Repainted tiles", repainted + TILES, page.getRepaintedTileCount());
+    }
+}
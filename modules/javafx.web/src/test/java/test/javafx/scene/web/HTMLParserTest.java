@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static javafx.concurrent.Worker.State.SUCCEEDED;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import javafx.scene.web.WebEngineShim;
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+/**
+ * Checks that speculative HTML tokenization builds the same DOM as the
+ * main thread tokenizer when network chunks end inside a token.
+ */
+public class HTMLParserTest extends TestBase {
+
+    // The network layer hands data to WebCore in buffers of this size
+    private static final int CHUNK_SIZE = 40 * 1024;
+    private static final int CHUNK_COUNT = 5;
+
+    private static Path dir;
+
+    @BeforeClass
+    public static void beforeClass() throws IOException {
+        dir = Files.createTempDirectory("htmlparsertest");
+    }
+
+    @AfterClass
+    public static void afterClass() {
+        for (File f : dir.toFile().listFiles()) {
+            f.delete();
+        }
+        dir.toFile().delete();
+    }
+
+    /**
+     * Writes a page in which every chunk boundary after the first falls
+     * between {@code head} and {@code tail}. The document.write() call in
+     * the first chunk makes the parser drop its first speculation, so it
+     * has to start speculating again at a chunk boundary.
+     */
+    private static File createPage(String name, String head, String tail) throws IOException {
+        final StringBuilder html = new StringBuilder();
+        html.append("<!DOCTYPE html>\n<html><head><title>").append(name).append("</title></head>\n<body>\n")
+            .append("<script>document.write('<p id=\"written\">written</p>');</script>\n");
+        for (int chunk = 1; chunk < CHUNK_COUNT; chunk++) {
+            final int split = chunk * CHUNK_SIZE - head.length();
+            int line = 0;
+            while (html.length() < split - 64) {
+                html.append("<div class=\"filler\">").append(chunk).append('.').append(line++)
+                    .append(" text &amp; more text</div>\n");
+            }
+            while (html.length() < split) {
+                html.append(' ');
+            }
+            html.append(head).append(tail).append('\n');
+        }
+        html.append("</body></html>\n");
+
+        final File file = dir.resolve(name + ".html").toFile();
+        Files.write(file.toPath(), html.toString().getBytes(StandardCharsets.US_ASCII));
+        return file;
+    }
+
+    private String loadDocument(File file, boolean speculate) {
+        submit(() -> {
+            WebEngineShim.getPage(getEngine()).overridePreference(
+                    "SpeculativeHTMLTokenizationEnabled", Boolean.toString(speculate));
+        });
+        load(file);
+        assertEquals(SUCCEEDED, getEngine().getLoadWorker().getState());
+        final String html = (String) executeScript("document.documentElement.outerHTML");
+        assertNotNull(html);
+        return html;
+    }
+
+    private void testSplit(String name, String head, String tail, String check) throws IOException {
+        final File file = createPage(name, head, tail);
+        final String expected = loadDocument(file, false);
+        final String actual = loadDocument(file, true);
+        assertEquals("DOM should not depend on speculation", expected, actual);
+        assertEquals("written", executeScript("document.getElementById('written').textContent"));
+        assertEquals(Integer.valueOf(CHUNK_COUNT - 1), executeScript(check));
+    }
+
+    @Test public void testChunkEndsInsideTag() throws IOException {
+        testSplit("tag", "<sp", "an class=\"split\">tag</span>",
+                "document.querySelectorAll('span.split').length");
+    }
+
+    @Test public void testChunkEndsInsideAttribute() throws IOException {
+        testSplit("attribute", "<span class=\"split\" title=\"attri", "bute value\">attribute</span>",
+                "document.querySelectorAll('span[title=\"attribute value\"]').length");
+    }
+
+    @Test public void testChunkEndsInsideEntity() throws IOException {
+        testSplit("entity", "<span class=\"split\">&am", "p;&eacute;</span>",
+                "Array.from(document.querySelectorAll('span.split'))"
+                + ".filter(e => e.textContent === '&\\u00e9').length");
+    }
+
+    @Test public void testChunkEndsInsideComment() throws IOException {
+        testSplit("comment", "<span class=\"split\"><!-- comm", "ent <b>not</b> markup --></span>",
+                "Array.from(document.querySelectorAll('span.split'))"
+                + ".filter(e => e.firstChild.nodeType === Node.COMMENT_NODE"
+                + " && e.firstChild.data === ' comment <b>not</b> markup ').length");
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Comparator;
+import java.util.concurrent.CountDownLatch;
+import java.util.stream.Stream;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+/**
+ * IndexedDB databases live in the directory of the first WebEngine that
+ * applies a user data directory. The web test task does not fork per class,
+ * so build.gradle excludes this class from test and runs it in isolatedTest,
+ * in a JVM of its own.
+ */
+public class IndexedDatabaseTest extends TestBase {
+
+    private static final File PAGE = new File("src/test/resources/test/html/h1.html");
+    private static final String OPEN_DATABASE =
+            "window.idbResult = undefined;"
+            + "var request = indexedDB.open('test', 1);"
+            + "request.onupgradeneeded = function() {"
+            + "  request.result.createObjectStore('store');"
+            + "};"
+            + "request.onsuccess = function() {"
+            + "  var tx = request.result.transaction('store', 'readwrite');"
+            + "  tx.objectStore('store').put('value', 'key');"
+            + "  tx.oncomplete = function() { window.idbResult = 'complete'; };"
+            + "  tx.onerror = function() { window.idbResult = 'error'; };"
+            + "};"
+            + "request.onerror = function() { window.idbResult = 'error'; };";
+    private static final long TIMEOUT = 10000;
+
+    private static Path first;
+    private static Path second;
+
+    @BeforeClass
+    public static void createDirectories() throws IOException {
+        first = Files.createTempDirectory("idbfirst");
+        second = Files.createTempDirectory("idbsecond");
+    }
+
+    @AfterClass
+    public static void deleteDirectories() throws IOException {
+        for (Path dir : new Path[] { first, second }) {
+            try (Stream<Path> paths = Files.walk(dir)) {
+                paths.sorted(Comparator.reverseOrder())
+                     .map(Path::toFile)
+                     .forEach(File::delete);
+            }
+        }
+    }
+
+    @Test public void testDatabasesStoredUnderUserDataDirectory() throws Exception {
+        submit(() -> getEngine().setUserDataDirectory(first.toFile()));
+        load(PAGE);
+        openDatabase(getEngine());
+
+        Path databases = first.resolve("indexeddb");
+        assertTrue("Database files under " + databases, countFiles(databases) > 0);
+        long usage = submit(() -> WebEngineShim.getPage(getEngine()).getIndexedDatabaseUsage());
+        assertTrue("Disk usage", usage > 0);
+    }
+
+    @Test public void testSecondDirectoryIsNotUsed() throws Exception {
+        submit(() -> getEngine().setUserDataDirectory(first.toFile()));
+        load(PAGE);
+
+        WebEngine other = submit(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setUserDataDirectory(second.toFile());
+            return engine;
+        });
+        try {
+            load(other, PAGE);
+            openDatabase(other);
+
+            assertTrue("Database files under the first directory",
+                    countFiles(first.resolve("indexeddb")) > 0);
+            assertEquals("Database files under the second directory",
+                    0, countFiles(second.resolve("indexeddb")));
+        } finally {
+            submit(() -> WebEngineShim.dispose(other));
+        }
+    }
+
+    private void openDatabase(WebEngine engine) throws InterruptedException {
+        submit(() -> engine.executeScript(OPEN_DATABASE));
+        long deadline = System.currentTimeMillis() + TIMEOUT;
+        while (true) {
+            Object result = submit(() -> engine.executeScript("window.idbResult"));
+            if (!"undefined".equals(result)) {
+                assertEquals("IndexedDB transaction", "complete", result);
+                return;
+            }
+            if (System.currentTimeMillis() > deadline) {
+                fail("IndexedDB transaction timed out");
+            }
+            Thread.sleep(50);
+        }
+    }
+
+    private void load(WebEngine engine, File file) throws InterruptedException {
+        CountDownLatch latch = new CountDownLatch(1);
+        submit(() -> {
+            engine.getLoadWorker().stateProperty().addListener((ov, o, state) -> {
+                if (state == Worker.State.SUCCEEDED || state == Worker.State.FAILED) {
+                    latch.countDown();
+                }
+            });
+            engine.load(file.toURI().toASCIIString());
+        });
+        latch.await();
+    }
+
+    private static long countFiles(Path dir) throws IOException {
+        if (!Files.isDirectory(dir)) {
+            return 0;
+        }
+        try (Stream<Path> paths = Files.walk(dir)) {
+            return paths.filter(Files::isRegularFile).count();
+        }
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.PlatformUtil;
+import com.sun.webkit.WebPageShim;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import org.junit.Assume;
+import org.junit.Test;
+
+/**
+ * Checks that JavaScript code gives the same results once the JIT tiers have
+ * compiled it as it does in the interpreter. The JIT options are applied once,
+ * when WebPage is initialized, from the com.sun.webkit.use*JIT properties.
+ * build.gradle runs this class in isolatedTest, in a JVM of its own, so those
+ * options are the ones given on the command line and no other test class sees
+ * them change.
+ */
+public class JITTierTest extends TestBase {
+
+    // Kernels whose results depend on integer overflow, double rounding,
+    // typed arrays, string building and a type change that forces an OSR exit
+    // out of optimized code. Every kernel is first run cold, then often
+    // enough for the DFG and FTL tiers to compile it.
+    private static final String KERNELS =
+        "var kernels = {\n" +
+        "  intMath: function() {\n" +
+        "    var h = 0;\n" +
+        "    for (var i = 0; i < 2000; i++) { h = (h * 31 + i) | 0; h ^= h >>> 7; }\n" +
+        "    return h;\n" +
+        "  },\n" +
+        "  doubleMath: function() {\n" +
+        "    var s = 0;\n" +
+        "    for (var i = 1; i < 2000; i++) s += Math.sqrt(i) / (i + 0.5) * Math.sin(i);\n" +
+        "    return s;\n" +
+        "  },\n" +
+        "  typedArray: function() {\n" +
+        "    var a = new Float64Array(512), s = 0;\n" +
+        "    for (var i = 0; i < a.length; i++) a[i] = i * 1.5;\n" +
+        "    for (var j = 0; j < a.length; j++) s += a[j] * a[a.length - 1 - j];\n" +
+        "    return s;\n" +
+        "  },\n" +
+        "  strings: function() {\n" +
+        "    var s = '', c = 0;\n" +
+        "    for (var i = 0; i < 200; i++) s += String.fromCharCode(97 + i % 26);\n" +
+        "    for (var j = 0; j < s.length; j++) c = (c * 33 + s.charCodeAt(j)) | 0;\n" +
+        "    return c;\n" +
+        "  },\n" +
+        "  osrExit: function() {\n" +
+        "    var t = 0;\n" +
+        "    for (var i = 0; i < 2000; i++) {\n" +
+        "      var v = i < 1990 ? i : 'x' + i;\n" +
+        "      t += typeof v === 'number' ? v : v.length;\n" +
+        "    }\n" +
+        "    return t;\n" +
+        "  }\n" +
+        "};\n" +
+        "function checkKernels(runs) {\n" +
+        "  var failures = [];\n" +
+        "  for (var name in kernels) {\n" +
+        "    var expected = kernels[name]();\n" +
+        "    for (var r = 0; r < runs; r++) {\n" +
+        "      var actual = kernels[name]();\n" +
+        "      if (actual !== expected) {\n" +
+        "        failures.push(name + ' run ' + r + ': ' + actual + ' != ' + expected);\n" +
+        "        break;\n" +
+        "      }\n" +
+        "    }\n" +
+        "  }\n" +
+        "  return failures.join('; ');\n" +
+        "}\n";
+
+    @Test public void testFTLEnabledOnLinuxX64() {
+        Assume.assumeTrue(PlatformUtil.isLinux() && "amd64".equals(System.getProperty("os.arch")));
+        Assume.assumeTrue(Boolean.parseBoolean(System.getProperty("com.sun.webkit.useJIT", "true")));
+        Assume.assumeTrue(Boolean.parseBoolean(System.getProperty("com.sun.webkit.useDFGJIT", "true")));
+        Assume.assumeTrue(Boolean.parseBoolean(System.getProperty("com.sun.webkit.useFTLJIT", "true")));
+
+        loadContent("<html><body></body></html>");
+        assertTrue("FTL should be enabled on x86_64 Linux", submit(() -> WebPageShim.isFTLJITEnabled()));
+    }
+
+    @Test public void testOptimizedResultsMatchInterpreter() {
+        loadContent("<html><body></body></html>");
+        executeScript(KERNELS);
+        assertEquals("", executeScript("checkKernels(400)"));
+    }
+
+    @Test public void testStackOverflowInOptimizedCode() {
+        // The optimized tiers must honour the same stack limit as the
+        // interpreter, which leaves room for the Java frames below.
+        loadContent("<html><body></body></html>");
+        assertEquals("RangeError", executeScript(
+            "(function() {\n" +
+            "  function depth(n) { return n === 0 ? 0 : 1 + depth(n - 1); }\n" +
+            "  for (var i = 0; i < 20000; i++) depth(50);\n" +
+            "  try {\n" +
+            "    depth(1e7);\n" +
+            "    return 'no error';\n" +
+            "  } catch (e) {\n" +
+            "    return e instanceof RangeError ? 'RangeError' : String(e);\n" +
+            "  }\n" +
+            "})()"));
+    }
+}
@@ -25,6 +25,13 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.dom.JSData;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
 import javafx.scene.web.WebEngine;
 import netscape.javascript.JSException;
 import netscape.javascript.JSObject;
@@ -741,4 +748,117 @@ public class JavaScriptBridgeTest extends TestBase {
             doc.eval("x");
         });
     }
+
+    @Test public void testBulkDataRoundTrip() {
+        loadContent("<h1></h1>");
+        submit(() -> {
+            JSObject window = (JSObject) getEngine().executeScript("window");
+            Map<String, Object> value = new LinkedHashMap<>();
+            value.put("name", "points");
+            value.put("count", 3);
+            value.put("scale", 0.5);
+            value.put("flags", Arrays.asList(true, false, null));
+            value.put("xs", new double[] { 1.5, 2.5, 3.5 });
+            value.put("ids", new int[] { 7, 8, 9 });
+            JSData.setMember(window, "bulk", value);
+
+            assertEquals("points", getEngine().executeScript("bulk.name"));
+            assertEquals(3, getEngine().executeScript("bulk.count"));
+            assertEquals(true, getEngine().executeScript("bulk.xs instanceof Float64Array"));
+            assertEquals(true, getEngine().executeScript("bulk.ids instanceof Int32Array"));
+            assertEquals(Double.valueOf(7.5), getEngine().executeScript("bulk.xs.reduce((a, b) => a + b)"));
+
+            @SuppressWarnings("unchecked")
+            Map<String, Object> result = (Map<String, Object>) JSData.getMember(window, "bulk");
+            assertEquals(value.keySet(), result.keySet());
+            assertEquals("points", result.get("name"));
+            assertEquals(3, result.get("count"));
+            assertEquals(0.5, result.get("scale"));
+            assertEquals(Arrays.asList(true, false, null), result.get("flags"));
+            assertArrayEquals(new double[] { 1.5, 2.5, 3.5 }, (double[]) result.get("xs"), 0);
+            assertArrayEquals(new int[] { 7, 8, 9 }, (int[]) result.get("ids"));
+        });
+    }
+
+    @Test public void testBulkDataOwnProperties() {
+        loadContent("<h1></h1>");
+        submit(() -> {
+            getEngine().executeScript("var setterCalls = 0;"
+                    + "Object.defineProperty(Object.prototype, 'hooked', {"
+                    + "  set: function(v) { setterCalls++; }, configurable: true });"
+                    + "Object.defineProperty(Array.prototype, '0', {"
+                    + "  set: function(v) { setterCalls++; }, configurable: true });");
+            JSObject window = (JSObject) getEngine().executeScript("window");
+            Map<String, Object> proto = new LinkedHashMap<>();
+            proto.put("polluted", true);
+            Map<String, Object> value = new LinkedHashMap<>();
+            value.put("__proto__", proto);
+            value.put("hooked", 1);
+            value.put("list", Arrays.asList("a", "b"));
+            JSData.setMember(window, "bulk", value);
+
+            assertEquals(0, getEngine().executeScript("setterCalls"));
+            assertEquals(true, getEngine().executeScript(
+                    "Object.getPrototypeOf(bulk) === Object.prototype"));
+            assertEquals(true, getEngine().executeScript(
+                    "Object.getOwnPropertyNames(bulk).includes('__proto__')"));
+            assertEquals(true, getEngine().executeScript("bulk.polluted === undefined"));
+            assertEquals(true, getEngine().executeScript("bulk.hasOwnProperty('hooked')"));
+            assertEquals("a,b", getEngine().executeScript("bulk.list.join()"));
+
+            @SuppressWarnings("unchecked")
+            Map<String, Object> result = (Map<String, Object>) JSData.getMember(window, "bulk");
+            assertEquals(value.keySet(), result.keySet());
+            assertEquals(proto, result.get("__proto__"));
+            assertEquals(1, result.get("hooked"));
+        });
+    }
+
+    @Test public void testBulkDataCall() {
+        loadContent("<h1></h1>");
+        submit(() -> {
+            getEngine().executeScript("function sum(buffer, offset) {"
+                    + "  var bytes = new Uint8Array(buffer), total = offset;"
+                    + "  for (var i = 0; i < bytes.length; i++) total += bytes[i];"
+                    + "  return { copy: buffer, total: total };"
+                    + "}");
+            JSObject window = (JSObject) getEngine().executeScript("window");
+            ByteBuffer bytes = ByteBuffer.allocateDirect(256);
+            for (int i = 0; i < 256; i++) {
+                bytes.put((byte) 1);
+            }
+            bytes.flip().position(6);
+
+            Map<?, ?> result = (Map<?, ?>) JSData.call(window, "sum", bytes, 100);
+            assertEquals(350, result.get("total"));
+            ByteBuffer copy = (ByteBuffer) result.get("copy");
+            assertEquals(0, copy.position());
+            assertEquals(250, copy.remaining());
+            assertEquals(1, copy.get(0));
+            assertEquals(1, copy.get(249));
+        });
+    }
+
+    @Test public void testBulkDataCycle() {
+        loadContent("<h1></h1>");
+        submit(() -> {
+            getEngine().executeScript("var cyclic = {}; cyclic.self = cyclic;");
+            JSObject window = (JSObject) getEngine().executeScript("window");
+            try {
+                JSData.getMember(window, "cyclic");
+                fail("JSException expected but not thrown");
+            } catch (JSException ex) {
+                assertTrue(ex.getMessage().contains("nested too deeply"));
+            }
+
+            List<Object> list = new ArrayList<>();
+            list.add(list);
+            try {
+                JSData.setMember(window, "cyclic", list);
+                fail("IllegalArgumentException expected but not thrown");
+            } catch (IllegalArgumentException ex) {
+                // expected
+            }
+        });
+    }
 }
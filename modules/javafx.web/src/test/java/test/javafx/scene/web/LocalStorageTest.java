@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPage.LocalStorageStatistics;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
+import java.util.concurrent.CountDownLatch;
+import javafx.concurrent.Worker.State;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
+import org.junit.After;
+import org.junit.AfterClass;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+public class LocalStorageTest extends TestBase {
+
+    private static final File WRITER_DIR = new File("localstoragetest-writer");
+    private static final File READER_DIR = new File("localstoragetest-reader");
+    private static final File PAGE = new File("src/test/resources/test/html/ipsum.html");
+
+    // More than the number of changed items a single sync writes
+    private static final int ITEM_COUNT = 1500;
+    private static final int MAX_ITEMS_TO_SYNC = 1000;
+
+    private WebEngine writer;
+    private WebEngine reader;
+
+    @AfterClass
+    public static void afterClass() throws IOException {
+        deleteRecursively(WRITER_DIR);
+        deleteRecursively(READER_DIR);
+    }
+
+    @After
+    public void after() {
+        submit(() -> {
+            if (writer != null) {
+                WebEngineShim.dispose(writer);
+            }
+            if (reader != null) {
+                WebEngineShim.dispose(reader);
+            }
+        });
+    }
+
+    private WebEngine createWebEngine(File userDataDirectory) {
+        final WebEngine webEngine = submit(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setUserDataDirectory(userDataDirectory);
+            return engine;
+        });
+        final CountDownLatch latch = new CountDownLatch(1);
+        submit(() -> {
+            webEngine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+                if (n == State.SUCCEEDED || n == State.FAILED) {
+                    latch.countDown();
+                }
+            });
+            webEngine.load(PAGE.toURI().toASCIIString());
+        });
+        try {
+            latch.await();
+        } catch (InterruptedException ex) {
+            throw new AssertionError(ex);
+        }
+        return webEngine;
+    }
+
+    private static LocalStorageStatistics waitForSyncedItems(long syncedItems)
+            throws InterruptedException {
+        // Changed items are synced once per second
+        final long deadline = System.currentTimeMillis() + 15000;
+        LocalStorageStatistics statistics = WebPage.getLocalStorageStatistics();
+        while (statistics.getSyncedItems() < syncedItems) {
+            if (System.currentTimeMillis() > deadline) {
+                fail("Items were not synced: " + statistics);
+            }
+            Thread.sleep(100);
+            statistics = WebPage.getLocalStorageStatistics();
+        }
+        return statistics;
+    }
+
+    private static void copyDirectory(File from, File to) throws IOException {
+        to.mkdirs();
+        for (File f : from.listFiles()) {
+            // The shared memory index is rebuilt from the write-ahead log
+            if (f.isFile() && !f.getName().endsWith("-shm")) {
+                Files.copy(f.toPath(), new File(to, f.getName()).toPath(),
+                        StandardCopyOption.REPLACE_EXISTING);
+            }
+        }
+    }
+
+    private static void deleteRecursively(File file) throws IOException {
+        if (file.isDirectory()) {
+            for (File f : file.listFiles()) {
+                deleteRecursively(f);
+            }
+        }
+        if (file.exists() && !file.delete()) {
+            file.deleteOnExit();
+        }
+    }
+
+    @Test public void testLazyImportAndBatchedSync() throws Exception {
+        writer = createWebEngine(WRITER_DIR);
+
+        final LocalStorageStatistics beforeSync = WebPage.getLocalStorageStatistics();
+        submit(() -> {
+            writer.executeScript(
+                    "for (var i = 0; i < " + ITEM_COUNT + "; i++) {"
+                    + "  localStorage.setItem('key' + i, 'value' + i);"
+                    + "}");
+        });
+        final LocalStorageStatistics afterSync =
+                waitForSyncedItems(beforeSync.getSyncedItems() + ITEM_COUNT);
+
+        // The items do not fit a single sync, the rest goes to the next one
+        assertTrue("Items should take two syncs: " + afterSync,
+                afterSync.getSyncs() - beforeSync.getSyncs() >= 2);
+        assertTrue("Sync batch should be bounded: " + afterSync,
+                afterSync.getLargestSync() <= MAX_ITEMS_TO_SYNC);
+        assertTrue("Items should be deferred: " + afterSync,
+                afterSync.getDeferredItems() - beforeSync.getDeferredItems()
+                        >= ITEM_COUNT - MAX_ITEMS_TO_SYNC);
+
+        // A fresh directory with the same database is imported from disk
+        copyDirectory(new File(WRITER_DIR, "localstorage"),
+                new File(READER_DIR, "localstorage"));
+        final LocalStorageStatistics beforeImport = WebPage.getLocalStorageStatistics();
+        reader = createWebEngine(READER_DIR);
+
+        // The first lookups are made right after the import starts
+        final String result = submit(() -> (String) reader.executeScript(
+                "localStorage.getItem('key" + (ITEM_COUNT - 1) + "') + ','"
+                + " + localStorage.getItem('missing') + ','"
+                + " + localStorage.getItem('key0') + ','"
+                + " + localStorage.length"));
+        assertEquals("value" + (ITEM_COUNT - 1) + ",null,value0," + ITEM_COUNT, result);
+
+        final LocalStorageStatistics afterImport = WebPage.getLocalStorageStatistics();
+        assertEquals(1, afterImport.getImports() - beforeImport.getImports());
+        assertEquals(ITEM_COUNT,
+                afterImport.getImportedItems() - beforeImport.getImportedItems());
+
+        // Writes after the import are synced like any other
+        submit(() -> {
+            reader.executeScript("localStorage.setItem('key0', 'changed');");
+            assertEquals("changed", reader.executeScript("localStorage.getItem('key0')"));
+        });
+        waitForSyncedItems(afterImport.getSyncedItems() + 1);
+    }
+}
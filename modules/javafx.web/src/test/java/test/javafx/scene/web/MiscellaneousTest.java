@@ -56,7 +56,9 @@ import static org.junit.Assert.assertNotNull;
 import static org.junit.Assert.assertNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
+import static org.junit.Assume.assumeTrue;
 
+import com.sun.javafx.PlatformUtil;
 import javafx.scene.web.WebEngineShim;
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
@@ -244,6 +246,20 @@ public class MiscellaneousTest extends TestBase {
         });
     }
 
+    @Test public void testWebAssembly() {
+        String arch = System.getProperty("os.arch");
+        assumeTrue(PlatformUtil.isLinux() && ("amd64".equals(arch) || "aarch64".equals(arch)));
+        final WebEngine webEngine = createWebEngine();
+        submit(() -> {
+            // (module (func (export "add") (param i32 i32) (result i32)
+            //     local.get 0 local.get 1 i32.add))
+            assertEquals(5, webEngine.executeScript(
+                    "new WebAssembly.Instance(new WebAssembly.Module(new Uint8Array(["
+                    + "0,97,115,109,1,0,0,0,1,7,1,96,2,127,127,1,127,3,2,1,0,7,7,1,3,"
+                    + "97,100,100,0,0,10,9,1,7,0,32,0,32,1,106,11]))).exports.add(2, 3)"));
+        });
+    }
+
     private WebEngine createWebEngine() {
         return submit(() -> new WebEngine());
     }
@@ -25,13 +25,24 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.ScriptProfile;
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.WCRenderQueue;
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
 import java.util.concurrent.Callable;
+import java.util.concurrent.Future;
+import java.util.function.Predicate;
 import javafx.scene.web.WebEngineShim;
 
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
 import org.junit.Test;
 
 public class WebPageTest extends TestBase {
@@ -101,4 +112,258 @@ public class WebPageTest extends TestBase {
         WebPage page = WebEngineShim.getPage(getEngine());
         page.getClientLocationOffset(0, 0);
     }
+
+    @Test public void testRenderToRGBA() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<html><body style='margin:0;background:rgb(255,0,0)'>"
+                + "<div style='position:absolute;left:20px;top:0;"
+                + "width:20px;height:20px;background:rgb(0,0,255)'>"
+                + "</div></body></html>");
+        submit(() -> page.setBounds(0, 0, 40, 20));
+
+        ByteBuffer rgba = page.renderToRGBA(0, 0, 40, 20, 2f);
+        assertEquals("Buffer size", 80 * 40 * 4, rgba.capacity());
+        assertPixel(rgba, 80, 10, 10, 255, 0, 0);
+        assertPixel(rgba, 80, 70, 30, 0, 0, 255);
+    }
+
+    @Test public void testRecordPrintPages() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<div style='height:3000px'>Test</div>");
+
+        int pageCount = page.beginPrinting(500f, 700f);
+        assertTrue("Page count", pageCount > 1);
+        int[] pages = { 0, pageCount - 1 };
+        WCRenderQueue[] rqs = page.recordPrintPages(pages, 500f);
+        page.endPrinting();
+
+        assertEquals("Queue count", pages.length, rqs.length);
+        for (WCRenderQueue rq : rqs) {
+            assertFalse("Empty page recording", rq.isEmpty());
+            rq.dispose();
+        }
+    }
+
+    @Test public void testRecordPrintPagesLater() throws Exception {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<div style='height:3000px'>Test</div>");
+
+        int pageCount = page.beginPrinting(500f, 700f);
+        assertTrue("Page count", pageCount > 1);
+        int[] pages = { pageCount - 1, 0 };
+        Future<WCRenderQueue[]> f = page.recordPrintPagesLater(pages, 500f);
+        WCRenderQueue[] rqs = WebPage.awaitPrintPages(f);
+        page.endPrinting();
+
+        assertTrue("Recording done", f.isDone());
+        assertEquals("Queue count", pages.length, rqs.length);
+        for (WCRenderQueue rq : rqs) {
+            assertFalse("Empty page recording", rq.isEmpty());
+            rq.dispose();
+        }
+    }
+
+    @Test public void testReleaseMemory() {
+        loadContent(HTML);
+        submit(() -> {
+            WebPage.MemoryStatistics before = WebPage.getMemoryStatistics();
+            assertTrue("JS heap size", before.getJSHeapSize() > 0);
+
+            WebPage.releaseMemory(WebPage.MEMORY_PRESSURE_CRITICAL);
+            WebPage.MemoryStatistics after = WebPage.getMemoryStatistics();
+            assertEquals("Back-forward cache pages", 0, after.getBackForwardCachePageCount());
+            assertTrue("Memory cache size",
+                    after.getMemoryCacheSize() <= before.getMemoryCacheSize());
+        });
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testReleaseMemoryInvalidLevel() {
+        WebPage.releaseMemory(0);
+    }
+
+    @Test public void testSamplingProfiler() {
+        loadContent(HTML);
+        submit(() -> {
+            if (!WebPage.startSamplingProfiler(500)) {
+                return;
+            }
+            getEngine().executeScript("function spin() {"
+                    + "  var end = Date.now() + 200, n = 0;"
+                    + "  while (Date.now() < end) n++;"
+                    + "  return n;"
+                    + "}"
+                    + "spin();");
+            ScriptProfile profile = WebPage.stopSamplingProfiler();
+            assertTrue("Sample count", profile.getSampleCount() > 0);
+
+            boolean sawSpin = false;
+            for (int i = 0; i < profile.getStackCount(); i++) {
+                int[] frames = profile.getStackFrames(i);
+                assertTrue("Stack depth", frames.length > 0);
+                for (int frame : frames) {
+                    if ("spin".equals(profile.getFunctionName(frame))) {
+                        sawSpin = true;
+                        assertTrue("Function line", profile.getFunctionLine(frame) > 0);
+                    }
+                }
+            }
+            assertTrue("Samples in spin()", sawSpin);
+            assertTrue("Folded stacks", profile.toFoldedStacks().contains("spin"));
+        });
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testSamplingProfilerInvalidInterval() {
+        WebPage.startSamplingProfiler(0);
+    }
+
+    @Test public void testBytecodeCache() throws Exception {
+        enableBytecodeCache();
+        File page = writeScriptPage("cached", "");
+        WebPage.BytecodeCacheStatistics before = submit(WebPage::getBytecodeCacheStatistics);
+
+        load(page);
+        WebPage.BytecodeCacheStatistics first = waitForStatistics(
+                s -> s.getStores() > before.getStores());
+        assertTrue("Misses", first.getMisses() > before.getMisses());
+        assertEquals("Hits", before.getHits(), first.getHits());
+        assertTrue("Bytes stored", first.getBytesStored() > before.getBytesStored());
+
+        reloadWithoutCode(page);
+        WebPage.BytecodeCacheStatistics second = submit(WebPage::getBytecodeCacheStatistics);
+        assertTrue("Hits", second.getHits() > first.getHits());
+        assertEquals("Misses", first.getMisses(), second.getMisses());
+        assertTrue("Bytes loaded", second.getBytesLoaded() > first.getBytesLoaded());
+        assertEquals("Script result", 42, executeScript("cachedResult"));
+    }
+
+    // Keeps one function hot long enough to reach the JIT tiers.
+    private static String hotLoop(String name) {
+        return "function " + name + "Hot(n) { var s = 0; for (var i = 0; i < n; i++) s += i; return s; }\n"
+                + "for (var j = 0; j < 5000; j++) " + name + "Hot(100);\n";
+    }
+
+    @Test public void testWarmUpProfile() throws Exception {
+        File dir = enableBytecodeCache();
+        submit(() -> WebPage.setWarmUpProfileEnabled(true));
+        File page = writeScriptPage("warmup", hotLoop("warmup"));
+        WebPage.BytecodeCacheStatistics before = submit(WebPage::getBytecodeCacheStatistics);
+
+        WebPage.BytecodeCacheStatistics first = runAndStoreWarmUpProfile(page, before);
+        assertTrue("Tier-ups", first.getWarmUpTierUps() > before.getWarmUpTierUps());
+        assertEquals("Profiles loaded", before.getWarmUpProfilesLoaded(), first.getWarmUpProfilesLoaded());
+        assertEquals("Hints", before.getWarmUpHints(), first.getWarmUpHints());
+        File[] profiles = dir.listFiles((d, name) -> name.endsWith(".jswp"));
+        assertTrue("Profile files", profiles != null && profiles.length > 0);
+
+        load(page);
+        assertEquals("Script result", 42, executeScript("warmupResult"));
+        WebPage.BytecodeCacheStatistics second = submit(WebPage::getBytecodeCacheStatistics);
+        assertTrue("Profiles loaded", second.getWarmUpProfilesLoaded() > first.getWarmUpProfilesLoaded());
+        assertTrue("Hints", second.getWarmUpHints() > first.getWarmUpHints());
+        assertTrue("Cold time to steady state", second.getColdTimeToSteadyStateMicros() > 0);
+        assertTrue(second.toString().contains("warmUpHints=" + second.getWarmUpHints()));
+    }
+
+    @Test public void testWarmUpProfileRejectedForChangedSource() throws Exception {
+        enableBytecodeCache();
+        submit(() -> WebPage.setWarmUpProfileEnabled(true));
+        File page = writeScriptPage("changed", hotLoop("changed"));
+        WebPage.BytecodeCacheStatistics before = submit(WebPage::getBytecodeCacheStatistics);
+        WebPage.BytecodeCacheStatistics first = runAndStoreWarmUpProfile(page, before);
+
+        // Same URL and length, different digest
+        File js = new File(page.getParentFile(), "changed.js");
+        String source = new String(Files.readAllBytes(js.toPath()), StandardCharsets.UTF_8);
+        Files.write(js.toPath(), source.replace("changed0(42)", "changed1(42)")
+                .getBytes(StandardCharsets.UTF_8));
+
+        load(page);
+        assertEquals("Script result", 43, executeScript("changedResult"));
+        WebPage.BytecodeCacheStatistics second = submit(WebPage::getBytecodeCacheStatistics);
+        assertEquals("Profiles loaded", first.getWarmUpProfilesLoaded(), second.getWarmUpProfilesLoaded());
+        assertEquals("Hints", first.getWarmUpHints(), second.getWarmUpHints());
+    }
+
+    // Runs the page, then drops it so the warm-up profile is written.
+    private WebPage.BytecodeCacheStatistics runAndStoreWarmUpProfile(
+            File page, WebPage.BytecodeCacheStatistics before)
+            throws InterruptedException {
+        load(page);
+        loadContent(PLAIN);
+        submit(() -> WebPage.releaseMemory(WebPage.MEMORY_PRESSURE_CRITICAL));
+        return waitForStatistics(
+                s -> s.getWarmUpProfilesStored() > before.getWarmUpProfilesStored());
+    }
+
+    private static File bytecodeCacheDirectory;
+
+    // The cache directory can only be set once per process, so all cache
+    // tests share it.
+    private File enableBytecodeCache() throws IOException {
+        if (bytecodeCacheDirectory == null) {
+            File dir = Files.createTempDirectory("bytecodecache").toFile();
+            dir.deleteOnExit();
+            assertTrue("Cache enabled", submit(() -> WebPage.setBytecodeCachePath(dir.getPath())));
+            bytecodeCacheDirectory = dir;
+        }
+        return bytecodeCacheDirectory;
+    }
+
+    // Writes a page with an external script long enough to be cached.
+    // The script defines <name>Result and runs <body> after it.
+    private static File writeScriptPage(String name, String body) throws IOException {
+        File dir = Files.createTempDirectory(name).toFile();
+        StringBuilder script = new StringBuilder();
+        for (int i = 0; i < 200; i++) {
+            script.append("function ").append(name).append(i)
+                  .append("(x) { return x + ").append(i).append("; }\n");
+        }
+        script.append("var ").append(name).append("Result = ")
+              .append(name).append("0(42);\n").append(body);
+        File js = new File(dir, name + ".js");
+        File html = new File(dir, name + ".html");
+        Files.write(js.toPath(), script.toString().getBytes(StandardCharsets.UTF_8));
+        Files.write(html.toPath(), ("<html><body><script src='" + js.getName()
+                + "'></script></body></html>").getBytes(StandardCharsets.UTF_8));
+        for (File f : new File[] { js, html, dir }) {
+            f.deleteOnExit();
+        }
+        return html;
+    }
+
+    // Drops the compiled code and the JSC in-memory code cache, so the
+    // next load of the page has to go to the bytecode cache.
+    private void reloadWithoutCode(File page) {
+        loadContent(PLAIN);
+        submit(() -> WebPage.releaseMemory(WebPage.MEMORY_PRESSURE_CRITICAL));
+        load(page);
+    }
+
+    // Cache files are written on a background queue.
+    private WebPage.BytecodeCacheStatistics waitForStatistics(
+            Predicate<WebPage.BytecodeCacheStatistics> condition)
+            throws InterruptedException {
+        long deadline = System.currentTimeMillis() + 10000;
+        while (true) {
+            WebPage.BytecodeCacheStatistics statistics =
+                    submit(WebPage::getBytecodeCacheStatistics);
+            if (condition.test(statistics)) {
+                return statistics;
+            }
+            assertTrue("Timed out waiting for the bytecode cache",
+                    System.currentTimeMillis() < deadline);
+            Thread.sleep(50);
+        }
+    }
+
+    private static void assertPixel(ByteBuffer rgba, int stride,
+                                    int x, int y, int r, int g, int b) {
+        int i = (y * stride + x) * 4;
+        assertEquals("Red at " + x + "," + y, r, rgba.get(i) & 0xff);
+        assertEquals("Green at " + x + "," + y, g, rgba.get(i + 1) & 0xff);
+        assertEquals("Blue at " + x + "," + y, b, rgba.get(i + 2) & 0xff);
+        assertEquals("Alpha at " + x + "," + y, 255, rgba.get(i + 3) & 0xff);
+    }
 }
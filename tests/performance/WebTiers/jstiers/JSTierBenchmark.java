@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jstiers;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.InputStreamReader;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicReference;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * A JetStream-style benchmark that compares the JavaScriptCore tiers of
+ * WebView. Each tier runs in its own JVM, because the JIT configuration is
+ * process wide and fixed when the first WebPage is created.
+ * <p>
+ * Every workload is run {@code ITERATIONS} times. As in JetStream, the score of
+ * a workload is the geometric mean of the scores of the first iteration (start
+ * up), the average of the four worst iterations and the average of all
+ * iterations, where the score of a time {@code t} in milliseconds is
+ * {@code 5000 / t}. The tier score is the geometric mean of its workloads.
+ * <p>
+ * Every workload also returns a checksum. The checksums must be the same in
+ * all tiers, otherwise the benchmark fails, so it also validates that the
+ * optimizing tiers compute what the interpreter does.
+ * <p>
+ * Run it with {@code gradle :web:jsTierBenchmark} after building the sdk, or
+ * compile the class, copy {@code workloads.js} next to it and run it with the
+ * JavaFX modules on the module path, e.g.
+ * {@code java --module-path <sdk>/lib --add-modules javafx.web jstiers.JSTierBenchmark}.
+ * Pass tier names to run a subset: {@code llint baseline dfg ftl}, or
+ * {@code -PJSTIERS="dfg ftl"} with gradle.
+ */
+public class JSTierBenchmark {
+
+    private static final int ITERATIONS = 60;
+    private static final int WORST_COUNT = 4;
+    private static final String RESULT_PREFIX = "RESULT ";
+
+    private enum Tier {
+        LLINT("-Dcom.sun.webkit.useJIT=false"),
+        BASELINE("-Dcom.sun.webkit.useDFGJIT=false"),
+        DFG("-Dcom.sun.webkit.useFTLJIT=false"),
+        FTL();
+
+        final String[] options;
+
+        Tier(String... options) {
+            this.options = options;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (Boolean.getBoolean("jstiers.child")) {
+            runWorkloads();
+            return;
+        }
+
+        List<Tier> tiers = new ArrayList<>();
+        for (String arg : args) {
+            tiers.add(Tier.valueOf(arg.toUpperCase()));
+        }
+        if (tiers.isEmpty()) {
+            tiers.addAll(List.of(Tier.values()));
+        }
+
+        Map<Tier, Map<String, Double>> scores = new LinkedHashMap<>();
+        Map<String, String> checksums = new LinkedHashMap<>();
+        boolean failed = false;
+        for (Tier tier : tiers) {
+            System.out.println("Running " + tier + "...");
+            Map<String, Double> tierScores = new LinkedHashMap<>();
+            failed |= !runTier(tier, tierScores, checksums);
+            scores.put(tier, tierScores);
+        }
+        printReport(scores);
+        if (failed) {
+            System.exit(1);
+        }
+    }
+
+    /**
+     * Starts a child JVM configured for the given tier and collects the
+     * score of every workload it reports. Returns false if the child failed or
+     * a checksum differs from the one a previous tier reported.
+     */
+    private static boolean runTier(Tier tier, Map<String, Double> results, Map<String, String> checksums)
+            throws IOException, InterruptedException {
+        List<String> command = new ArrayList<>();
+        command.add(System.getProperty("java.home") + File.separator + "bin" + File.separator + "java");
+        String modulePath = System.getProperty("jdk.module.path");
+        if (modulePath != null) {
+            command.add("--module-path");
+            command.add(modulePath);
+            command.add("--add-modules");
+            command.add("javafx.web");
+        }
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        command.add("-Djstiers.child=true");
+        command.addAll(List.of(tier.options));
+        command.add(JSTierBenchmark.class.getName());
+
+        Process process = new ProcessBuilder(command).redirectErrorStream(true).start();
+        boolean passed = true;
+        try (BufferedReader reader = new BufferedReader(
+                new InputStreamReader(process.getInputStream(), StandardCharsets.UTF_8))) {
+            String line;
+            while ((line = reader.readLine()) != null) {
+                if (!line.startsWith(RESULT_PREFIX)) {
+                    System.out.println("  " + line);
+                    continue;
+                }
+                String[] fields = line.substring(RESULT_PREFIX.length()).split(" ");
+                results.put(fields[0], Double.parseDouble(fields[1]));
+                System.out.printf("  %-22s %8.2f  (checksum %s)%n", fields[0], Double.parseDouble(fields[1]), fields[2]);
+                String expected = checksums.putIfAbsent(fields[0], fields[2]);
+                if (expected != null && !expected.equals(fields[2])) {
+                    System.out.println("  " + tier + " " + fields[0] + " checksum differs, expected " + expected);
+                    passed = false;
+                }
+            }
+        }
+        int exitCode = process.waitFor();
+        if (exitCode != 0) {
+            System.out.println("  " + tier + " exited with " + exitCode);
+            passed = false;
+        }
+        return passed;
+    }
+
+    private static void printReport(Map<Tier, Map<String, Double>> scores) {
+        List<String> names = new ArrayList<>();
+        for (Map<String, Double> tierScores : scores.values()) {
+            for (String name : tierScores.keySet()) {
+                if (!names.contains(name)) {
+                    names.add(name);
+                }
+            }
+        }
+
+        System.out.println();
+        System.out.printf("%-22s", "workload");
+        for (Tier tier : scores.keySet()) {
+            System.out.printf(" %10s", tier);
+        }
+        System.out.println();
+        for (String name : names) {
+            System.out.printf("%-22s", name);
+            for (Map<String, Double> tierScores : scores.values()) {
+                Double score = tierScores.get(name);
+                System.out.printf(score != null ? " %10.2f" : " %10s", score != null ? score : "-");
+            }
+            System.out.println();
+        }
+        System.out.printf("%-22s", "geomean");
+        for (Map<String, Double> tierScores : scores.values()) {
+            System.out.printf(" %10.2f", geometricMean(tierScores.values()));
+        }
+        System.out.println();
+    }
+
+    /**
+     * Child side: loads the workloads into a WebEngine and prints one result
+     * line per workload.
+     */
+    private static void runWorkloads() throws Exception {
+        String script;
+        try (InputStream in = JSTierBenchmark.class.getResourceAsStream("workloads.js")) {
+            script = new String(in.readAllBytes(), StandardCharsets.UTF_8);
+        }
+
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        CountDownLatch done = new CountDownLatch(1);
+        AtomicReference<Throwable> failure = new AtomicReference<>();
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.getLoadWorker().stateProperty().addListener((ov, o, state) -> {
+                if (state != Worker.State.SUCCEEDED) {
+                    return;
+                }
+                try {
+                    engine.executeScript(script);
+                    String names = (String) engine.executeScript("workloadNames()");
+                    for (String name : names.split(",")) {
+                        String times = (String) engine.executeScript(
+                                "runWorkload('" + name + "', " + ITERATIONS + ")");
+                        String[] values = times.split(",");
+                        double[] millis = new double[ITERATIONS];
+                        for (int i = 0; i < ITERATIONS; i++) {
+                            millis[i] = Double.parseDouble(values[i]);
+                        }
+                        System.out.println(RESULT_PREFIX + name + " " + score(millis) + " " + values[ITERATIONS]);
+                    }
+                } catch (Throwable t) {
+                    failure.set(t);
+                } finally {
+                    done.countDown();
+                }
+            });
+            engine.loadContent("<html><body></body></html>");
+        });
+        done.await();
+        Platform.exit();
+
+        if (failure.get() != null) {
+            failure.get().printStackTrace();
+            System.exit(1);
+        }
+    }
+
+    private static double score(double[] millis) {
+        double first = millis[0];
+        double[] sorted = millis.clone();
+        Arrays.sort(sorted);
+        double worst = 0;
+        for (int i = 0; i < WORST_COUNT; i++) {
+            worst += sorted[sorted.length - 1 - i];
+        }
+        worst /= WORST_COUNT;
+        double average = 0;
+        for (double m : millis) {
+            average += m;
+        }
+        average /= millis.length;
+        return geometricMean(List.of(toScore(first), toScore(worst), toScore(average)));
+    }
+
+    private static double toScore(double millis) {
+        // performance.now() may be coarse, so never divide by zero.
+        return 5000 / Math.max(millis, 0.01);
+    }
+
+    private static double geometricMean(Iterable<Double> values) {
+        double logSum = 0;
+        int count = 0;
+        for (double value : values) {
+            logSum += Math.log(value);
+            count++;
+        }
+        return count == 0 ? 0 : Math.exp(logSum / count);
+    }
+}
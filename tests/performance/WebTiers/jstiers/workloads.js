@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+// Small compute kernels in the spirit of JetStream. Each workload returns a
+// checksum so the work cannot be optimized away and tiers can be compared
+// for correctness as well as speed.
+var workloads = {
+    "float-mm": function() {
+        var n = 48, a = new Float64Array(n * n), b = new Float64Array(n * n), c = new Float64Array(n * n);
+        for (var i = 0; i < n * n; i++) {
+            a[i] = (i % 7) * 0.5;
+            b[i] = (i % 5) * 0.25;
+        }
+        for (var i = 0; i < n; i++) {
+            for (var j = 0; j < n; j++) {
+                var sum = 0;
+                for (var k = 0; k < n; k++)
+                    sum += a[i * n + k] * b[k * n + j];
+                c[i * n + j] = sum;
+            }
+        }
+        return c[n * n - 1];
+    },
+
+    "nbody": function() {
+        var bodies = [];
+        for (var i = 0; i < 5; i++)
+            bodies.push({ x: i, y: i * 0.5, z: -i, vx: 0, vy: 0, vz: 0, mass: 1 + i * 0.1 });
+        for (var step = 0; step < 2000; step++) {
+            for (var i = 0; i < bodies.length; i++) {
+                var bi = bodies[i];
+                for (var j = i + 1; j < bodies.length; j++) {
+                    var bj = bodies[j];
+                    var dx = bi.x - bj.x, dy = bi.y - bj.y, dz = bi.z - bj.z;
+                    var d2 = dx * dx + dy * dy + dz * dz + 0.01;
+                    var mag = 0.001 / (d2 * Math.sqrt(d2));
+                    bi.vx -= dx * bj.mass * mag; bi.vy -= dy * bj.mass * mag; bi.vz -= dz * bj.mass * mag;
+                    bj.vx += dx * bi.mass * mag; bj.vy += dy * bi.mass * mag; bj.vz += dz * bi.mass * mag;
+                }
+            }
+            for (var i = 0; i < bodies.length; i++) {
+                var b = bodies[i];
+                b.x += 0.01 * b.vx; b.y += 0.01 * b.vy; b.z += 0.01 * b.vz;
+            }
+        }
+        return bodies[0].x;
+    },
+
+    "polymorphic-objects": function() {
+        function Circle(r) { this.r = r; }
+        Circle.prototype.area = function() { return 3.14159 * this.r * this.r; };
+        function Rect(w, h) { this.w = w; this.h = h; }
+        Rect.prototype.area = function() { return this.w * this.h; };
+        function Tri(b, h) { this.b = b; this.h = h; }
+        Tri.prototype.area = function() { return 0.5 * this.b * this.h; };
+        var total = 0;
+        for (var i = 0; i < 30000; i++) {
+            var shape = (i % 3 == 0) ? new Circle(i % 10) : (i % 3 == 1) ? new Rect(i % 7, 2) : new Tri(i % 5, 3);
+            total += shape.area();
+        }
+        return total;
+    },
+
+    "int-hash": function() {
+        var h0 = 0x67452301, h1 = 0xEFCDAB89, h2 = 0x98BADCFE, h3 = 0x10325476;
+        for (var i = 0; i < 200000; i++) {
+            var f = (h1 & h2) | (~h1 & h3);
+            var t = (((h0 << 5) | (h0 >>> 27)) + f + i + 0x5A827999) | 0;
+            h3 = h2; h2 = (h1 << 30) | (h1 >>> 2); h1 = h0; h0 = t;
+        }
+        return (h0 ^ h1 ^ h2 ^ h3) >>> 0;
+    },
+
+    "json": function() {
+        var data = [];
+        for (var i = 0; i < 500; i++)
+            data.push({ id: i, name: "item" + i, tags: ["a", "b", "c"], price: i * 1.25, active: (i & 1) == 0 });
+        var checksum = 0;
+        for (var r = 0; r < 5; r++) {
+            var parsed = JSON.parse(JSON.stringify(data));
+            checksum += parsed[r * 10].price;
+        }
+        return checksum;
+    },
+
+    "regexp": function() {
+        var text = "";
+        for (var i = 0; i < 200; i++)
+            text += "user" + i + "@example" + (i % 9) + ".com, 2026-10-" + (10 + i % 18) + "; ";
+        var emails = 0, dates = 0;
+        for (var r = 0; r < 10; r++) {
+            emails += (text.match(/[a-z0-9]+@[a-z0-9]+\.com/g) || []).length;
+            dates += (text.match(/\d{4}-\d{2}-\d{2}/g) || []).length;
+        }
+        return emails + dates;
+    },
+
+    "string-build": function() {
+        var parts = [];
+        for (var i = 0; i < 20000; i++)
+            parts.push(String.fromCharCode(97 + i % 26) + i);
+        var s = parts.join("|");
+        return s.length + s.indexOf("z25");
+    }
+};
+
+// Runs a workload the given number of times and returns the duration of every
+// iteration in milliseconds followed by the checksum of the last iteration.
+function runWorkload(name, iterations) {
+    var fn = workloads[name];
+    var times = [];
+    var result = 0;
+    for (var i = 0; i < iterations; i++) {
+        var start = performance.now();
+        result = fn();
+        times.push(performance.now() - start);
+    }
+    times.push(result);
+    return times.join(",");
+}
+
+function workloadNames() {
+    return Object.keys(workloads).join(",");
+}
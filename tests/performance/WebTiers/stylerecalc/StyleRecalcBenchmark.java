@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package stylerecalc;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.util.Arrays;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicReference;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Measures style recalculation on a synthetic data grid after class changes
+ * on {@code <body>}, with and without the fast path that copies inherited
+ * colors into the existing style of descendants instead of matching rules
+ * again.
+ * <p>
+ * The grid has {@code ROWS * COLUMNS} cells. The "recolor" case only changes
+ * inherited colors and is eligible for the fast path; the "resize" case
+ * changes the font size and always resolves every cell in full.
+ * <p>
+ * The preference is toggled through the internal WebPage, so the class must
+ * be run with
+ * {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED --add-opens javafx.web/javafx.scene.web=ALL-UNNAMED}.
+ */
+public class StyleRecalcBenchmark {
+
+    private static final int ROWS = 2000;
+    private static final int COLUMNS = 12;
+    private static final int ITERATIONS = 40;
+    private static final String PREFERENCE = "FastPathStyleInheritanceEnabled";
+
+    private static final String PAGE =
+            "<html><head><style>"
+            + "body { color: #222; background: white; font: 13px sans-serif; }"
+            + "body.dark { color: #ddd; background: #222; }"
+            + "body.large { font-size: 15px; }"
+            + "td { padding: 2px 6px; border-bottom: 1px solid currentColor; }"
+            + "tr:nth-child(even) td { background: rgba(0, 0, 0, 0.05); }"
+            + "td.num { text-align: right; }"
+            + "</style></head><body><table id='grid'></table></body></html>";
+
+    private static final String BUILD_GRID =
+            "(function() {"
+            + "  var table = document.getElementById('grid');"
+            + "  for (var r = 0; r < " + ROWS + "; r++) {"
+            + "    var row = table.insertRow();"
+            + "    for (var c = 0; c < " + COLUMNS + "; c++) {"
+            + "      var cell = row.insertCell();"
+            + "      if (c % 3 == 0) cell.className = 'num';"
+            + "      var span = document.createElement('span');"
+            + "      span.textContent = 'r' + r + 'c' + c;"
+            + "      cell.appendChild(span);"
+            + "    }"
+            + "  }"
+            + "  return document.getElementsByTagName('*').length;"
+            + "})()";
+
+    private static String toggleScript(String className) {
+        // getComputedStyle() forces a style update without a layout.
+        return "(function() {"
+                + "  var cell = document.getElementById('grid').rows[" + (ROWS - 1) + "].cells[0];"
+                + "  getComputedStyle(cell).color;"
+                + "  var start = performance.now();"
+                + "  document.body.classList.toggle('" + className + "');"
+                + "  getComputedStyle(cell).color;"
+                + "  return performance.now() - start;"
+                + "})()";
+    }
+
+    public static void main(String[] args) throws Exception {
+        CountDownLatch startup = new CountDownLatch(1);
+        Platform.startup(startup::countDown);
+        startup.await();
+
+        try {
+            for (boolean enabled : new boolean[] { false, true }) {
+                System.out.println(PREFERENCE + "=" + enabled);
+                for (String className : new String[] { "dark", "large" }) {
+                    double[] millis = run(enabled, className);
+                    Arrays.sort(millis);
+                    System.out.printf("  %-8s median %8.2f ms  min %8.2f ms  max %8.2f ms%n",
+                            className.equals("dark") ? "recolor" : "resize",
+                            millis[millis.length / 2], millis[0], millis[millis.length - 1]);
+                }
+            }
+        } finally {
+            Platform.exit();
+        }
+    }
+
+    /**
+     * Loads the grid into a new WebEngine and returns the time of each
+     * toggle of the given class.
+     */
+    private static double[] run(boolean enabled, String className) throws Exception {
+        double[] millis = new double[ITERATIONS];
+        CountDownLatch done = new CountDownLatch(1);
+        AtomicReference<Throwable> failure = new AtomicReference<>();
+        Platform.runLater(() -> {
+            try {
+                WebEngine engine = new WebEngine();
+                overridePreference(engine, PREFERENCE, Boolean.toString(enabled));
+                engine.getLoadWorker().stateProperty().addListener((ov, o, state) -> {
+                    if (state != Worker.State.SUCCEEDED) {
+                        return;
+                    }
+                    try {
+                        engine.executeScript(BUILD_GRID);
+                        String script = toggleScript(className);
+                        for (int i = 0; i < ITERATIONS; i++) {
+                            millis[i] = ((Number) engine.executeScript(script)).doubleValue();
+                        }
+                    } catch (Throwable t) {
+                        failure.set(t);
+                    } finally {
+                        done.countDown();
+                    }
+                });
+                engine.loadContent(PAGE);
+            } catch (Throwable t) {
+                failure.set(t);
+                done.countDown();
+            }
+        });
+        done.await();
+        if (failure.get() != null) {
+            throw new RuntimeException(failure.get());
+        }
+        return millis;
+    }
+
+    private static void overridePreference(WebEngine engine, String key, String value) throws ReflectiveOperationException {
+        Field pageField = WebEngine.class.getDeclaredField("page");
+        pageField.setAccessible(true);
+        Object page = pageField.get(engine);
+        Method method = page.getClass().getMethod("overridePreference", String.class, String.class);
+        method.invoke(page, key, value);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene;
+
+import javafx.scene.Group;
+import javafx.scene.image.PixelReader;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.shape.Rectangle;
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+import test.util.Util;
+
+import static org.junit.Assert.assertEquals;
+
+/**
+ * Renders batches of solid quads large enough to wrap the streaming vertex
+ * buffer of the es2 pipeline (prism.streamvbo) several times and checks
+ * every quad's color. Other pipelines check the same output.
+ */
+public class QuadBatchSnapshotTest extends SnapshotCommon {
+
+    private static final int CELLS = 64;
+    private static final int CELL_SIZE = 4;
+    // Each snapshot uploads about 512KB of vertices, the streaming buffer
+    // starts at 1MB, so this orphans it more than once.
+    private static final int SNAPSHOTS = 6;
+
+    @BeforeClass
+    public static void setupOnce() {
+        // Off by default, read when the toolkit starts; system tests fork per class
+        System.setProperty("prism.streamvbo", "true");
+        doSetupOnce();
+    }
+
+    @AfterClass
+    public static void teardownOnce() {
+        doTeardownOnce();
+    }
+
+    private static Color cellColor(int x, int y, int pass) {
+        return Color.rgb((x * 4 + pass) & 0xff, (y * 4) & 0xff, ((x + y) * 2 + pass * 16) & 0xff);
+    }
+
+    @Test
+    public void testQuadColorsAcrossBatches() {
+        for (int pass = 0; pass < SNAPSHOTS; pass++) {
+            final int p = pass;
+            Util.runAndWait(() -> {
+                Group root = new Group();
+                for (int y = 0; y < CELLS; y++) {
+                    for (int x = 0; x < CELLS; x++) {
+                        Rectangle r = new Rectangle(x * CELL_SIZE, y * CELL_SIZE, CELL_SIZE, CELL_SIZE);
+                        r.setFill(cellColor(x, y, p));
+                        root.getChildren().add(r);
+                    }
+                }
+                WritableImage image = root.snapshot(null, null);
+                assertEquals(CELLS * CELL_SIZE, (int) image.getWidth());
+                assertEquals(CELLS * CELL_SIZE, (int) image.getHeight());
+
+                PixelReader reader = image.getPixelReader();
+                for (int y = 0; y < CELLS; y++) {
+                    for (int x = 0; x < CELLS; x++) {
+                        Color expected = cellColor(x, y, p);
+                        Color actual = reader.getColor(x * CELL_SIZE + CELL_SIZE / 2,
+                                                       y * CELL_SIZE + CELL_SIZE / 2);
+                        String where = "pass " + p + ", cell " + x + "," + y;
+                        assertEquals(where, expected.getRed(), actual.getRed(), 1.5 / 255);
+                        assertEquals(where, expected.getGreen(), actual.getGreen(), 1.5 / 255);
+                        assertEquals(where, expected.getBlue(), actual.getBlue(), 1.5 / 255);
+                    }
+                }
+            });
+        }
+    }
+}